@@ -79,6 +79,15 @@ public:
     */
     PeptideHit compute(PeptideHit & hit, RichPeakSpectrum & real_spectrum, DoubleReal fmt, Int number_of_phospho_sites);
 
+    /**
+        @brief Computes the AScore for several peptide hits in parallel.
+
+        The result at position i is the result of compute(hits[i], real_spectra[i], fmt, number_of_phospho_sites).
+
+        @exception Exception::IllegalArgument is thrown if the numbers of hits and spectra differ
+    */
+    std::vector<PeptideHit> compute(std::vector<PeptideHit> & hits, std::vector<RichPeakSpectrum> & real_spectra, DoubleReal fmt, Int number_of_phospho_sites);
+
     ///Computes the cumulative binomial probabilities.
     DoubleReal computeCumulativeScore(UInt N, UInt n, DoubleReal p);
 
@@ -97,6 +106,13 @@ private:
 public:
     ///helperfunction
     std::vector<Size> computeTupel_(AASequence & without_phospho);
+    /**
+        @brief Creates the theoretical b- and y-ion spectra (named by their sequence) of all phosphorylation site permutations of @p without_phospho
+
+        The fragment masses of the backbone are computed only once; the ions of each permutation are shifted by the number of phosphorylated sites they contain.
+        The spectra are the same as those of the TheoreticalSpectrumGenerator (with default parameters).
+    */
+    void createTheoreticalSpectra_(std::vector<RichPeakSpectrum> & th_spectra, const std::vector<std::vector<Size> > & permutations, const AASequence & without_phospho, Int charge);
     ///helper function
     std::vector<std::vector<Size> > computePermutations_(std::vector<Size> tupel, Int number_of_phospho_sites);
   };
@@ -173,6 +173,17 @@ public:
 
        */
     void queryByMass(const DoubleReal& observed_mass, const Int& observed_charge, std::vector<AccurateMassSearchResult>& results);
+
+    /**
+      @brief search many observed masses at once
+
+      Equivalent to calling queryByMass() for each pair of @p observed_masses and @p observed_charges, i.e. results[i]
+      holds the hits of the i-th mass (in the same order). The adducts are parsed only once and the masses are searched
+      in parallel, which is much faster for large maps.
+
+      @exception Exception::InvalidParameter is thrown if the sizes of @p observed_masses and @p observed_charges differ
+    */
+    void queryByMasses(const std::vector<DoubleReal>& observed_masses, const std::vector<Int>& observed_charges, std::vector<std::vector<AccurateMassSearchResult> >& results);
     void queryByFeature(const Feature& feature, const Size& feature_index, std::vector<AccurateMassSearchResult>& results);
     void queryByConsensusFeature(const ConsensusFeature& cfeat, const Size& cf_index, const Size& number_of_maps, std::vector<AccurateMassSearchResult>& results);
 
@@ -240,6 +251,41 @@ private:
     */
     void computeNeutralMassFromAdduct_(const DoubleReal& observed_mass, const String& adduct_string, DoubleReal& neutral_mass, Int& charge_value);
 
+    /// adduct parsed from the adducts file, the neutral mass of an observed mass is computed from it without string parsing
+    struct AdductInfo_
+    {
+      String name;
+      Int charge;
+      bool is_intrinsic;
+      DoubleReal mol_multiplier;
+      /// masses of the adduct compounds, added to the decharged mass (in order)
+      std::vector<DoubleReal> mass_terms;
+    };
+
+    /// parse an adduct string (e.g. "M+H;1+") into @p adduct
+    void parseAdduct_(const String& adduct_string, AdductInfo_& adduct) const;
+
+    /// returns the parsed adducts of the current ion mode (parses the adduct strings on first use)
+    const std::vector<AdductInfo_>& getActiveAdducts_();
+
+    /// computes the neutral mass of @p adduct_mass assuming the adduct @p adduct
+    DoubleReal computeNeutralMass_(const DoubleReal& adduct_mass, const AdductInfo_& adduct) const;
+
+    /// computes the tolerance window [@p lower, @p upper] around @p neutral_query_mass
+    void getMassWindow_(const DoubleReal& neutral_query_mass, DoubleReal& lower, DoubleReal& upper) const;
+
+    /// appends the database entries [@p start_idx, @p end_idx) as hits for the given query to @p results
+    void addHits_(const DoubleReal& adduct_mass, const Int& adduct_charge, const DoubleReal& query_mass, const String& adduct_name, Size start_idx, Size end_idx, std::vector<AccurateMassSearchResult>& results) const;
+
+    /// sets RT, index and intensity of @p feature for all @p results
+    void annotateFeatureResults_(const Feature& feature, const Size& feature_index, std::vector<AccurateMassSearchResult>& results) const;
+
+    /// sets RT, index and per-map intensities of @p cfeat for all @p results
+    void annotateConsensusResults_(const ConsensusFeature& cfeat, const Size& cf_index, const Size& number_of_maps, std::vector<AccurateMassSearchResult>& results) const;
+
+    /// computes the isotope similarity of all hits and keeps only the best one
+    void scoreIsotopePatterns_(const Feature& feature, std::vector<AccurateMassSearchResult>& results);
+
     DoubleReal computeCosineSim_(const std::vector<DoubleReal>& x, const std::vector<DoubleReal>& y);
     DoubleReal computeEuclideanDist_(const std::vector<DoubleReal>& x, const std::vector<DoubleReal>& y);
     DoubleReal computeIsotopePatternSimilarity_(const Feature&, const EmpiricalFormula&);
@@ -298,6 +344,11 @@ private:
 
     StringList pos_adducts_;
     StringList neg_adducts_;
+
+    std::vector<AdductInfo_> pos_adduct_infos_;
+    std::vector<AdductInfo_> neg_adduct_infos_;
+    bool pos_adducts_parsed_;
+    bool neg_adducts_parsed_;
   };
 
 }
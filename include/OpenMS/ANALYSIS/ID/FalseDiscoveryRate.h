@@ -39,6 +39,7 @@
 #include <OpenMS/METADATA/PeptideIdentification.h>
 #include <OpenMS/METADATA/ProteinIdentification.h>
 
+#include <utility>
 #include <vector>
 
 namespace OpenMS
@@ -107,8 +108,14 @@ private:
     ///Not implemented
     FalseDiscoveryRate & operator=(const FalseDiscoveryRate &);
 
+    /// mapping of scores to FDRs (or q-values), sorted by score
+    typedef std::vector<std::pair<DoubleReal, DoubleReal> > ScoreToFDR_;
+
     /// calculates the fdr stored into fdrs, given two vectors of scores
-    void calculateFDRs_(Map<DoubleReal, DoubleReal> & score_to_fdr, std::vector<DoubleReal> & target_scores, std::vector<DoubleReal> & decoy_scores, bool q_value, bool higher_score_better);
+    void calculateFDRs_(ScoreToFDR_ & score_to_fdr, std::vector<DoubleReal> & target_scores, std::vector<DoubleReal> & decoy_scores, bool q_value, bool higher_score_better) const;
+
+    /// looks up the FDR of @p score in @p score_to_fdr (0 if the score is unknown)
+    static DoubleReal getFDR_(const ScoreToFDR_ & score_to_fdr, DoubleReal score);
 
   };
 
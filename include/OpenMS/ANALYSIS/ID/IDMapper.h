@@ -197,8 +197,6 @@ public:
 
       // calculate feature bounding boxes only once:
       std::vector<DBoundingBox<2> > boxes;
-      DoubleReal min_rt = std::numeric_limits<DoubleReal>::max(),
-                 max_rt = -std::numeric_limits<DoubleReal>::max();
       // std::cout << "Precomputing bounding boxes..." << std::endl;
       boxes.reserve(map.size());
       for (typename FeatureMap<FeatureType>::Iterator f_it = map.begin();
@@ -221,72 +219,40 @@ public:
         }
         increaseBoundingBox_(box);
         boxes.push_back(box);
-
-        min_rt = std::min(min_rt, box.minPosition().getX());
-        max_rt = std::max(max_rt, box.maxPosition().getX());
       }
 
-      // hash bounding boxes of features by RT:
-      // RT range is partitioned into slices (bins) of 1 second; every feature
-      // that overlaps a certain slice is hashed into the corresponding bin
-      std::vector<std::vector<SignedSize> > hash_table;
-      // make sure the RT hash table has indices >= 0 and doesn't waste space
-      // in the beginning:
-      SignedSize offset(0);
-
-      if (map.size() > 0)
-      {
-        // std::cout << "Setting up hash table..." << std::endl;
-        offset = SignedSize(floor(min_rt));
-        // this only works if features were found
-        hash_table.resize(SignedSize(floor(max_rt)) - offset + 1);
-        for (Size index = 0; index < boxes.size(); ++index)
-        {
-          const DBoundingBox<2> & box = boxes[index];
-          for (SignedSize i = SignedSize(floor(box.minPosition().getX()));
-               i <= SignedSize(floor(box.maxPosition().getX())); ++i)
-          {
-            hash_table[i - offset].push_back(index);
-          }
-        }
-      }
-      else
+      // index bounding boxes of features by RT and m/z:
+      // RT range is partitioned into slices of 1 second; every feature that
+      // overlaps a certain slice is stored in the corresponding slice
+      if (map.size() == 0)
       {
         LOG_WARN << "IDMapper received an empty FeatureMap! All peptides are mapped as 'unassigned'!" << std::endl;
       }
+      BoxIndex_ box_index(boxes, 1.0);
 
-      // for statistics:
-      Size matches_none = 0, matches_single = 0, matches_multi = 0;
+      // find the matching features of all peptide IDs (in parallel), the
+      // annotation is done afterwards in the order of the IDs
+      std::vector<std::vector<Size> > id_matches(ids.size());
 
-      // std::cout << "Finding matches..." << std::endl;
-      // iterate over peptide IDs:
-      for (std::vector<PeptideIdentification>::const_iterator id_it =
-             ids.begin(); id_it != ids.end(); ++id_it)
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 100)
+#endif
+      for (SignedSize i = 0; i < (SignedSize)ids.size(); ++i)
       {
-        // std::cout << "Peptide ID: " << id_it - ids.begin() << std::endl;
-
-        if (id_it->getHits().empty()) continue;
+        const PeptideIdentification & id = ids[i];
+        if (id.getHits().empty()) continue;
 
         DoubleList mz_values;
         DoubleReal rt_value;
         IntList charges;
-        getIDDetails_(*id_it, rt_value, mz_values, charges, use_avg_mass);
-
-        if ((rt_value < min_rt) || (rt_value > max_rt))             // RT out of bounds
-        {
-          map.getUnassignedPeptideIdentifications().push_back(*id_it);
-          ++matches_none;
-          continue;
-        }
+        getIDDetails_(id, rt_value, mz_values, charges, use_avg_mass);
 
-        // iterate over candidate features:
-        Size index = SignedSize(floor(rt_value)) - offset;
-        Size matching_features = 0;
-        for (std::vector<SignedSize>::iterator hash_it =
-               hash_table[index].begin(); hash_it != hash_table[index].end();
-             ++hash_it)
+        // iterate over candidate features (all features whose box contains the RT of the ID):
+        std::vector<Size> candidates;
+        box_index.query(DBoundingBox<2>(DPosition<2>(rt_value, -std::numeric_limits<DoubleReal>::max()), DPosition<2>(rt_value, std::numeric_limits<DoubleReal>::max())), candidates);
+        for (std::vector<Size>::const_iterator cand_it = candidates.begin(); cand_it != candidates.end(); ++cand_it)
         {
-          Feature & feat = map[*hash_it];
+          const FeatureType & feat = map[*cand_it];
 
           // need to check the charge state?
           bool check_charge = !ignore_charge_;
@@ -307,19 +273,18 @@ public:
             }
 
             DPosition<2> id_pos(rt_value, *mz_it);
-            if (boxes[*hash_it].encloses(id_pos))                 // potential match
+            if (boxes[*cand_it].encloses(id_pos))                 // potential match
             {
               if (use_centroid_mz)
               {
                 // only one m/z value to check, which was already incorporated
                 // into the overall bounding box -> success!
-                feat.getPeptideIdentifications().push_back(*id_it);
-                ++matching_features;
+                id_matches[i].push_back(*cand_it);
                 break;                     // "mz_it" loop
               }
               // else: check all the mass traces
               bool found_match = false;
-              for (std::vector<ConvexHull2D>::iterator ch_it =
+              for (std::vector<ConvexHull2D>::const_iterator ch_it =
                      feat.getConvexHulls().begin(); ch_it !=
                    feat.getConvexHulls().end(); ++ch_it)
               {
@@ -332,8 +297,7 @@ public:
                 increaseBoundingBox_(box);
                 if (box.encloses(id_pos))                     // success!
                 {
-                  feat.getPeptideIdentifications().push_back(*id_it);
-                  ++matching_features;
+                  id_matches[i].push_back(*cand_it);
                   found_match = true;
                   break;                       // "ch_it" loop
                 }
@@ -342,12 +306,25 @@ public:
             }
           }
         }
-        if (matching_features == 0)
+      }
+
+      // for statistics:
+      Size matches_none = 0, matches_single = 0, matches_multi = 0;
+
+      for (Size i = 0; i < ids.size(); ++i)
+      {
+        if (ids[i].getHits().empty()) continue;
+
+        for (std::vector<Size>::const_iterator match_it = id_matches[i].begin(); match_it != id_matches[i].end(); ++match_it)
+        {
+          map[*match_it].getPeptideIdentifications().push_back(ids[i]);
+        }
+        if (id_matches[i].empty())
         {
-          map.getUnassignedPeptideIdentifications().push_back(*id_it);
+          map.getUnassignedPeptideIdentifications().push_back(ids[i]);
           ++matches_none;
         }
-        else if (matching_features == 1) ++matches_single;
+        else if (id_matches[i].size() == 1) ++matches_single;
         else ++matches_multi;
       }
 
@@ -376,6 +353,42 @@ public:
     void annotate(ConsensusMap & map, const std::vector<PeptideIdentification> & ids, const std::vector<ProteinIdentification> & protein_ids, bool measure_from_subelements = false);
 
 protected:
+    /**
+      @brief Spatial index over (RT, m/z) bounding boxes
+
+      The RT range is partitioned into slices of equal width and every box is
+      stored in all slices it overlaps. Within a slice, boxes are sorted by
+      their lower m/z bound, so a query only visits boxes whose m/z range can
+      intersect the query box.
+
+      The index keeps a reference to the boxes, which must not change while the
+      index is in use. Queries are thread-safe.
+    */
+    class OPENMS_DLLAPI BoxIndex_
+    {
+public:
+      /// builds the index over @p boxes, using RT slices of (at least) @p rt_slice_width
+      BoxIndex_(const std::vector<DBoundingBox<2> > & boxes, DoubleReal rt_slice_width);
+
+      /// stores the indices of all boxes intersecting @p query in @p result (sorted ascending)
+      void query(const DBoundingBox<2> & query, std::vector<Size> & result) const;
+
+private:
+      /// orders box indices by lower m/z bound
+      struct MinMZLess_;
+
+      /// the indexed boxes
+      const std::vector<DBoundingBox<2> > & boxes_;
+      /// lower RT bound of the first slice
+      DoubleReal rt_min_;
+      /// width of an RT slice
+      DoubleReal slice_width_;
+      /// box indices per RT slice, sorted by lower m/z bound
+      std::vector<std::vector<Size> > slices_;
+      /// largest m/z extent of any box per slice
+      std::vector<DoubleReal> max_mz_width_;
+    };
+
     void updateMembers_();
 
     ///Allowed RT deviation
@@ -41,6 +41,7 @@
 
 #include <OpenMS/KERNEL/MSSpectrum.h>
 #include <OpenMS/KERNEL/MSChromatogram.h>
+#include <OpenMS/KERNEL/PeakArrays.h>
 #include <OpenMS/ANALYSIS/TARGETED/TargetedExperiment.h>
 #include <OpenMS/ANALYSIS/OPENSWATH/OPENSWATHALGO/DATAACCESS/TransitionExperiment.h>
 #include <OpenMS/ANALYSIS/OPENSWATH/OPENSWATHALGO/DATAACCESS/ISpectrumAccess.h>
@@ -60,6 +61,12 @@ public:
     /// Convert an OpenMS Spectrum to an SpectrumPtr
     static OpenSwath::SpectrumPtr convertToSpectrumPtr(const OpenMS::MSSpectrum<> & spectrum);
 
+    /// Convert PeakArrays to a SpectrumPtr, taking over the arrays without copying them (@p arrays is empty afterwards)
+    static OpenSwath::SpectrumPtr convertToSpectrumPtr(PeakArrays & arrays);
+
+    /// Convert a SpectrumPtr to PeakArrays, taking over the arrays of @p sptr without copying them (the arrays of @p sptr are empty afterwards)
+    static void convertToPeakArrays(OpenSwath::SpectrumPtr sptr, PeakArrays & arrays);
+
     /// Convert a ChromatogramPtr to an OpenMS Chromatogram
     static void convertToOpenMSChromatogram(OpenMS::MSChromatogram<> & chromatogram, const OpenSwath::ChromatogramPtr cptr);
 
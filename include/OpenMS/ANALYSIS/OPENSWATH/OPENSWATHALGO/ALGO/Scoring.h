@@ -37,6 +37,7 @@
 
 #include <numeric>
 #include <map>
+#include <utility>
 #include <vector>
 
 #include <OpenMS/ANALYSIS/OPENSWATH/OPENSWATHALGO/OpenSwathAlgoConfig.h>
@@ -53,8 +54,36 @@ namespace OpenSwath
   {
     /** @name Type defs */
     //@{
-    /// Cross Correlation array
-    typedef std::map<int, double> XCorrArrayType;
+    /**
+      @brief Cross Correlation array
+
+      Stores the cross-correlation values as one contiguous array of (lag,
+      value) pairs sorted by lag. Lags are equally spaced, which allows
+      constant-time lookup through find().
+    */
+    struct OPENSWATHALGO_DLLAPI XCorrArrayType
+    {
+public:
+      /// the (lag, value) pairs, sorted by lag
+      std::vector<std::pair<int, double> > data;
+
+      typedef std::vector<std::pair<int, double> >::iterator iterator;
+      typedef std::vector<std::pair<int, double> >::const_iterator const_iterator;
+
+      iterator begin() {return data.begin(); }
+      const_iterator begin() const {return data.begin(); }
+      iterator end() {return data.end(); }
+      const_iterator end() const {return data.end(); }
+
+      /// number of lags stored
+      std::size_t size() const {return data.size(); }
+
+      /// returns the entry with lag @p lag or end() if there is no such lag
+      iterator find(int lag);
+
+      /// returns the entry with lag @p lag or end() if there is no such lag
+      const_iterator find(int lag) const;
+    };
     //@}
 
     /** @name Helper functions */
@@ -99,13 +128,29 @@ namespace OpenSwath
 
     /// Calculate crosscorrelation on std::vector data (which is first normalized)
     /// NOTE: this replaces calcxcorr 
+    /// Always uses the direct computation, so the scores do not depend on the trace length
     OPENSWATHALGO_DLLAPI XCorrArrayType normalizedCrossCorrelation(std::vector<double>& data1,
                                                             std::vector<double>& data2, int maxdelay, int lag);
 
-    /// Calculate crosscorrelation on std::vector data without normalization
+    /**
+      @brief Calculate crosscorrelation on std::vector data without normalization
+
+      Computes the crosscorrelation for all delays in [-maxdelay, maxdelay]
+      (in steps of @p lag). Short traces are correlated directly, long traces
+      with lag 1 are correlated through an FFT whenever this is cheaper. The
+      FFT values differ from the direct sum by rounding.
+    */
     OPENSWATHALGO_DLLAPI XCorrArrayType calculateCrossCorrelation(std::vector<double>& data1,
                                                       std::vector<double>& data2, int maxdelay, int lag);
 
+    /// Calculate crosscorrelation on std::vector data without normalization using only the direct (non-FFT) computation
+    OPENSWATHALGO_DLLAPI XCorrArrayType calculateCrossCorrelationDirect(const std::vector<double>& data1,
+                                                      const std::vector<double>& data2, int maxdelay, int lag);
+
+    /// Calculate crosscorrelation on std::vector data without normalization using an FFT (lag 1 only)
+    OPENSWATHALGO_DLLAPI XCorrArrayType calculateCrossCorrelationFFT(const std::vector<double>& data1,
+                                                      const std::vector<double>& data2, int maxdelay);
+
     /// Find best peak in an cross-correlation (highest apex)
     OPENSWATHALGO_DLLAPI XCorrArrayType::iterator xcorrArrayGetMaxPeak(XCorrArrayType & array);
 
@@ -37,10 +37,12 @@
 
 #include <OpenMS/ANALYSIS/QUANTITATION/IsobaricQuantitationMethod.h>
 
+#include <OpenMS/CONCEPT/ProgressLogger.h>
 #include <OpenMS/DATASTRUCTURES/DefaultParamHandler.h>
 
 #include <OpenMS/KERNEL/MSExperiment.h>
 #include <OpenMS/KERNEL/ConsensusMap.h>
+#include <OpenMS/KERNEL/RangeUtils.h>
 
 namespace OpenMS
 {
@@ -74,7 +76,23 @@ public:
     */
     void extractChannels(const MSExperiment<Peak1D>& ms_exp_data, ConsensusMap& consensus_map);
 
+    /**
+      @brief Extracts the isobaric channels from the tandem MS data in an mzML file and stores intensity values in a consensus map.
+
+      The spectra are streamed from the file and processed in batches, so the experiment is never loaded completely.
+      The result is the same as loading the file and calling extractChannels(const MSExperiment<Peak1D>&, ConsensusMap&).
+
+      @param filename mzML file to search for isobaric quantitation channels.
+      @param consensus_map Output map containing the identified channels and the corresponding intensities.
+      @param log_type Progress log type used while reading the file.
+    */
+    void extractChannels(const String& filename, ConsensusMap& consensus_map, ProgressLogger::LogType log_type = ProgressLogger::NONE);
+
 private:
+    /// Consumer of spectra streamed from a file, see extractChannels(const String&, ConsensusMap&)
+    class ExtractionConsumer_;
+    friend class ExtractionConsumer_;
+
     /// The used quantitation method (itraq4plex, tmt6plex,..).
     const IsobaricQuantitationMethod* quant_method_;
 
@@ -122,24 +140,45 @@ private:
     bool hasLowIntensityReporter_(const ConsensusFeature& cf) const;
 
     /**
-      @brief Computes the purity of the precursor given an iterator pointing to the MS/MS spectrum and one to the precursor spectrum.
+      @brief Checks if the given spectrum is used for the channel extraction (activation method and precursor constraints).
+
+      @param spectrum The spectrum to test.
+      @param activation_predicate Predicate selecting the spectra with the requested activation method.
+      @return $true$ if the channels of the spectrum should be extracted, $false$ otherwise.
+      @throws Exception::MissingInformation if the spectrum has the requested activation method but no precursor.
+    */
+    bool isSelectedSpectrum_(const MSExperiment<Peak1D>::SpectrumType& spectrum, const HasActivationMethod<MSExperiment<Peak1D>::SpectrumType>& activation_predicate) const;
+
+    /**
+      @brief Extracts the channels of a batch of selected tandem spectra and appends the resulting ConsensusFeatures to @p consensus_map.
+
+      Precursor purity and reporter intensities of the spectra are computed in parallel.
+
+      @param ms2_spectra The selected tandem spectra, in the order they appear in the experiment.
+      @param precursor_spectra The precursor spectrum of each tandem spectrum, or 0 if there is none.
+      @param consensus_map Output map the features are appended to.
+    */
+    void extractChannels_(const std::vector<const MSExperiment<Peak1D>::SpectrumType*>& ms2_spectra, const std::vector<const MSExperiment<Peak1D>::SpectrumType*>& precursor_spectra, ConsensusMap& consensus_map) const;
+
+    /**
+      @brief Computes the purity of the precursor given the MS/MS spectrum and the precursor spectrum.
 
-      @param ms2_spec Iterator pointing to the ms2 spectrum.
-      @param precursor Iterator pointing to the precursor spectrum of ms2_spec.
+      @param ms2_spec The ms2 spectrum.
+      @param precursor The precursor spectrum of ms2_spec.
       @return Fraction of the total intensity in the isolation window of the precursor spectrum that was assigned to the precursor.
     */
-    DoubleReal computePrecursorPurity_(const MSExperiment<>::ConstIterator& ms2_spec, const MSExperiment<>::ConstIterator& precursor) const;
+    DoubleReal computePrecursorPurity_(const MSExperiment<Peak1D>::SpectrumType& ms2_spec, const MSExperiment<Peak1D>::SpectrumType& precursor) const;
 
     /**
       @brief Computes the sum of all isotopic peak intensities in the window defined by (lower|upper)_mz_bound beginning from theoretical_isotope_mz.
 
-      @param precursor Iterator pointing to the precursor spectrum used for extracting the peaks.
+      @param precursor The precursor spectrum used for extracting the peaks.
       @param lower_mz_bound Lower bound of the isolation window to analyze.
       @param upper_mz_bound Upper bound of the isolation window to analyze.
       @param theoretical_mz The start position for the search. Note that the intensity at this position will not included in the sum.
       @param isotope_offset The offset with which the isolation window should be searched (i.e., +/- NEUTRON_MASS/precursor_charge, +/- determines if it scans from left or right from the theoretical_isotope_mz).
     */
-    DoubleReal sumPotentialIsotopePeaks_(const MSExperiment<Peak1D>::ConstIterator& precursor, const Peak1D::CoordinateType& lower_mz_bound, const Peak1D::CoordinateType& upper_mz_bound, Peak1D::CoordinateType theoretical_mz, const Peak1D::CoordinateType isotope_offset) const;
+    DoubleReal sumPotentialIsotopePeaks_(const MSExperiment<Peak1D>::SpectrumType& precursor, const Peak1D::CoordinateType& lower_mz_bound, const Peak1D::CoordinateType& upper_mz_bound, Peak1D::CoordinateType theoretical_mz, const Peak1D::CoordinateType isotope_offset) const;
 
 protected:
     /// implemented for DefaultParamHandler
@@ -189,11 +189,34 @@ private:
     PeptideHit getAnnotation_(std::vector<PeptideIdentification> & peptides);
 
     /**
-         @brief Gather quantitative information from a feature.
+         @brief Gather quantitative information from features.
 
-         Store quantitative information from @p feature in member @p pep_quant_, based on the peptide annotation in @p hit. If @p hit is empty ("ambiguous/no annotation"), nothing is stored.
+         Store quantitative information from the features in [@p first, @p last) in member @p pep_quant_, based on their common peptide annotation in @p hit. If @p hit is empty ("ambiguous/no annotation"), nothing is stored.
     */
-    void quantifyFeature_(const FeatureHandle & feature, const PeptideHit & hit);
+    template <typename HandleIterator>
+    void quantifyFeatures_(HandleIterator first, HandleIterator last,
+                           const PeptideHit & hit)
+    {
+      if (hit == PeptideHit())
+      {
+        return; // annotation for the features is ambiguous or missing
+      }
+      // look up the peptide data only once for all features:
+      SampleAbundances & abundances =
+        pep_quant_[hit.getSequence()].abundances[hit.getCharge()];
+      for (; first != last; ++first)
+      {
+        stats_.quant_features++;
+        abundances[first->getMapIndex()] += first->getIntensity(); // new map element is initialized with 0
+      }
+    }
+
+    /**
+         @brief Get the (sorted) IDs of all samples that occur in the total abundances of the peptides.
+
+         The position of a sample ID in the result is the column of that sample in the flat (peptide x sample) tables used for normalization and protein quantification.
+    */
+    std::vector<UInt64> getSamples_() const;
 
     /**
          @brief Order keys (charges/peptides for peptide/protein quantification) according to how many samples they allow to quantify, breaking ties by total abundance.
@@ -201,7 +224,7 @@ private:
          The keys of @p abundances are stored ordered in @p result, best first.
     */
     template <typename T>
-    void orderBest_(const std::map<T, SampleAbundances> abundances,
+    void orderBest_(const std::map<T, SampleAbundances> & abundances,
                     std::vector<T> & result)
     {
       typedef std::pair<Size, DoubleReal> PairType;
@@ -256,8 +256,6 @@ private:
     void traversPeptide_(PeptideEntry * pep_node, MSDGroup & group);
     //searches given sequence in all  nodes and returns its index or nodes.size() if not found.
     Size findPeptideEntry_(String seq, std::vector<PeptideEntry> & nodes);
-    //helper function for findPeptideEntry.
-    Size binarySearchNodes_(String & seq, std::vector<PeptideEntry> & nodes, Size start, Size end);
     //includes all MS/MS derived peptides into the graph --idXML
     Size includeMSMSPeptides_(std::vector<PeptideIdentification> & peptide_identifications, std::vector<PeptideEntry> & peptide_nodes);
     //TODO include run information for each peptide
@@ -510,6 +510,40 @@ private:
 
     Size getNumberOfEnclosedPoints_(DoubleReal m1, DoubleReal m2, const std::vector<std::pair<DoubleReal, DoubleReal> > & points);
 
+    /**
+      @brief Creates random partitions like createRandomPartitions(const SVMData&, Size, std::vector<SVMData>&)
+
+      Additionally, the indices of the samples of 'problem' that were put into every
+      partition are stored in 'indices'.
+    */
+    static void createRandomPartitions_(const SVMData & problem,
+                                        Size number,
+                                        std::vector<SVMData> & problems,
+                                        std::vector<std::vector<Size> > & indices);
+
+    /**
+      @brief Computes the oligo kernel values of all pairs of sequences of 'problem' using the current gauss table
+
+      The values are stored row-wise in 'kernel' (both triangles, since the kernel function
+      is evaluated for both argument orders).
+    */
+    void computeOligoKernel_(const SVMData & problem, std::vector<DoubleReal> & kernel) const;
+
+    /**
+      @brief Trains the svm on the samples 'indices' of a precomputed kernel matrix of 'size' samples
+
+      'problem' has to contain the samples 'indices' in this order. The result is the same as
+      calling train(SVMData&) with 'problem'.
+    */
+    Int trainOnKernel_(const SVMData & problem, const std::vector<DoubleReal> & kernel, Size size, const std::vector<Size> & indices);
+
+    /**
+      @brief Predicts the samples 'rows' of a precomputed kernel matrix of 'size' samples
+
+      The model has to be trained on the samples 'columns' using trainOnKernel_().
+    */
+    void predictOnKernel_(const std::vector<DoubleReal> & kernel, Size size, const std::vector<Size> & rows, const std::vector<Size> & columns, std::vector<DoubleReal> & results);
+
     /**
       @brief Initializes the svm with standard parameters
 
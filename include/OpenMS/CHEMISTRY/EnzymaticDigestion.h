@@ -124,6 +124,17 @@ public:
     /// Performs the enzymatic digestion of a protein.
     void digest(const AASequence & protein, std::vector<AASequence> & output) const;
 
+    /**
+      @brief Computes the boundaries of the fully cleaved fragments of @p protein (given as one-letter code string)
+
+      @p boundaries starts with 0, followed by every position directly behind a cleavage site and ends with the
+      length of @p protein. The fragment [boundaries[i], boundaries[i + 1]) is the i-th peptide of digest().
+      The vector is cleared first, its capacity is reused.
+
+      @see EnzymaticDigestionCursor
+    */
+    void getFragmentBoundaries(const String & protein, std::vector<Size> & boundaries) const;
+
     /// Returns the number of peptides a digestion of @p protein would yield under the current enzyme and missed cleavage settings.
     Size peptideCount(const AASequence & protein);
 
@@ -186,6 +197,9 @@ protected:
     /// tests if position pointed to by @p p (N-term side) is a valid cleavage site
     bool isCleavageSite_(const AASequence & sequence, const AASequence::ConstIterator & p) const;
 
+    /// tests if position @p pos (N-term side) of the one-letter code sequence @p protein is a valid cleavage site
+    bool isCleavageSite_(const String & protein, Size pos) const;
+
     /// Number of missed cleavages
     SignedSize missed_cleavages_;
     /// Used enzyme
@@ -0,0 +1,170 @@
+// --------------------------------------------------------------------------
+//                   OpenMS -- Open-Source Mass Spectrometry
+// --------------------------------------------------------------------------
+// Copyright The OpenMS Team -- Eberhard Karls University Tuebingen,
+// ETH Zurich, and Freie Universitaet Berlin 2002-2013.
+//
+// This software is released under a three-clause BSD license:
+//  * Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//  * Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+//  * Neither the name of any author or any participating institution
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+// For a full list of authors, refer to the file AUTHORS.
+// --------------------------------------------------------------------------
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL ANY OF THE AUTHORS OR THE CONTRIBUTING
+// INSTITUTIONS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+// ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// --------------------------------------------------------------------------
+// $Maintainer: Chris Bielow $
+// $Authors: $
+// --------------------------------------------------------------------------
+
+#ifndef OPENMS_CHEMISTRY_ENZYMATICDIGESTIONCURSOR_H
+#define OPENMS_CHEMISTRY_ENZYMATICDIGESTIONCURSOR_H
+
+#include <OpenMS/CHEMISTRY/EnzymaticDigestion.h>
+
+#include <vector>
+
+namespace OpenMS
+{
+  /**
+    @brief Iterates over the digestion products of proteins without creating AASequence objects
+
+    EnzymaticDigestion::digest() creates an AASequence for every peptide, even if the caller is only
+    interested in peptides of a certain mass. The cursor instead works on the one-letter code of the protein
+    and yields (protein index, start, end, mass) tuples. Masses are computed from cumulative residue masses,
+    so no strings are parsed or copied. Only peptides with a mass in [min_mass, max_mass] are reported.
+
+    The products are reported in the same order as by EnzymaticDigestion::digest() (first all fully cleaved
+    peptides, then those with one missed cleavage etc.), and the settings of the EnzymaticDigestion (enzyme,
+    missed cleavages, log model) are respected. Specificity is not considered, just like in digest().
+
+    The internal buffers are reused by setProtein(), so digesting many proteins with the same cursor does not
+    allocate memory once the buffers are large enough. Use one cursor per thread to digest proteins in parallel:
+
+    @code
+    EnzymaticDigestion digestion;
+    #pragma omp parallel
+    {
+      EnzymaticDigestionCursor cursor(digestion, 1000.0, 3000.0);
+      EnzymaticDigestionCursor::Product product;
+      #pragma omp for
+      for (SignedSize i = 0; i < (SignedSize)proteins.size(); ++i)
+      {
+        cursor.setProtein(proteins[i].sequence, i);
+        while (cursor.next(product))
+        {
+          String peptide = proteins[i].sequence.substr(product.start, product.end - product.start);
+          ...
+        }
+      }
+    }
+    @endcode
+
+    Residues are expected as unmodified one-letter codes. Products which contain letters unknown to the ResidueDB
+    have no defined mass (NaN) and are skipped.
+  */
+  class OPENMS_DLLAPI EnzymaticDigestionCursor
+  {
+public:
+
+    /// A digestion product: the peptide is the substring [start, end) of the protein
+    struct Product
+    {
+      /// index of the protein (as given to setProtein())
+      Size protein_index;
+      /// start position of the peptide in the protein
+      Size start;
+      /// end position (exclusive) of the peptide in the protein
+      Size end;
+      /// monoisotopic mass of the uncharged peptide (with termini)
+      DoubleReal mass;
+    };
+
+    /**
+      @brief Constructor
+
+      @param digestion The digestion settings (a reference is kept, it must outlive the cursor)
+      @param min_mass Minimal mass of reported peptides
+      @param max_mass Maximal mass of reported peptides (a negative value means no upper limit)
+    */
+    explicit EnzymaticDigestionCursor(const EnzymaticDigestion & digestion, DoubleReal min_mass = 0.0, DoubleReal max_mass = -1.0);
+
+    /// Destructor
+    virtual ~EnzymaticDigestionCursor();
+
+    /// sets the mass window of reported peptides (a negative @p max_mass means no upper limit)
+    void setMassWindow(DoubleReal min_mass, DoubleReal max_mass);
+
+    /**
+      @brief Starts the digestion of @p protein
+
+      The cursor keeps a pointer to @p protein, it must not be changed or destroyed while iterating.
+    */
+    void setProtein(const String & protein, Size protein_index = 0);
+
+    /**
+      @brief Moves to the next digestion product in the mass window
+
+      @return false if there are no more products of the current protein
+    */
+    bool next(Product & product);
+
+protected:
+
+    /// the digestion settings
+    const EnzymaticDigestion & digestion_;
+
+    /// residue masses indexed by one-letter code (NaN if unknown)
+    std::vector<DoubleReal> residue_masses_;
+
+    /// mass window
+    DoubleReal min_mass_;
+    DoubleReal max_mass_;
+
+    /// the current protein
+    const String * protein_;
+    Size protein_index_;
+
+    /// fragment boundaries of the current protein (see EnzymaticDigestion::getFragmentBoundaries())
+    std::vector<Size> boundaries_;
+
+    /// cumulative residue masses of the current protein (prefix_masses_[i] is the mass of the first i residues)
+    std::vector<DoubleReal> prefix_masses_;
+
+    /// number of missed cleavages currently enumerated
+    Size missed_;
+
+    /// maximal number of missed cleavages
+    Size max_missed_;
+
+    /// index of the next start boundary
+    Size next_boundary_;
+
+private:
+
+    /// Not implemented
+    EnzymaticDigestionCursor(const EnzymaticDigestionCursor &);
+
+    /// Not implemented
+    EnzymaticDigestionCursor & operator=(const EnzymaticDigestionCursor &);
+
+  };
+
+} // namespace OpenMS
+
+#endif // OPENMS_CHEMISTRY_ENZYMATICDIGESTIONCURSOR_H
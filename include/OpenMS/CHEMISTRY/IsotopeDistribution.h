@@ -125,6 +125,8 @@ public:
 
         Implementation using the averagine model proposed by Senko et al. in
         "Determination of Monoisotopic Masses and Ion Populations for Large Biomolecules from Resolved Isotopic Distributions"
+
+        The patterns are cached by the IsotopePatternCache.
     */
     void estimateFromPeptideWeight(double average_weight);
 
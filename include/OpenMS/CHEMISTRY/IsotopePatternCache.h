@@ -0,0 +1,149 @@
+// --------------------------------------------------------------------------
+//                   OpenMS -- Open-Source Mass Spectrometry
+// --------------------------------------------------------------------------
+// Copyright The OpenMS Team -- Eberhard Karls University Tuebingen,
+// ETH Zurich, and Freie Universitaet Berlin 2002-2013.
+//
+// This software is released under a three-clause BSD license:
+//  * Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//  * Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+//  * Neither the name of any author or any participating institution
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+// For a full list of authors, refer to the file AUTHORS.
+// --------------------------------------------------------------------------
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL ANY OF THE AUTHORS OR THE CONTRIBUTING
+// INSTITUTIONS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+// ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// --------------------------------------------------------------------------
+// $Maintainer: Clemens Groepl, Andreas Bertsch $
+// $Authors: $
+// --------------------------------------------------------------------------
+//
+
+#ifndef OPENMS_CHEMISTRY_ISOTOPEPATTERNCACHE_H
+#define OPENMS_CHEMISTRY_ISOTOPEPATTERNCACHE_H
+
+#include <OpenMS/CHEMISTRY/IsotopeDistribution.h>
+
+#include <map>
+#include <vector>
+
+namespace OpenMS
+{
+  class Element;
+
+  /**
+    @ingroup Chemistry
+
+    @brief Thread-safe cache of isotope distributions
+
+    Feature finders, the accurate mass search and the simulator request the
+    same isotope patterns over and over again. This singleton stores
+
+    - the distributions of @em n atoms of an element (the convolution powers
+      used by EmpiricalFormula::getIsotopeDistribution) and
+    - averagine distributions (IsotopeDistribution::estimateFromPeptideWeight).
+
+    Averagine patterns are keyed by the rounded element counts the averagine
+    model derives from the weight, i.e. on the grid of weights that yield
+    identical distributions. Cached results are therefore identical to the
+    ones computed without the cache.
+
+    Only elements of the ElementDB are cached, distributions of other
+    Element objects are computed on every call. When the cache grows beyond
+    getMaxEntries() entries, it is cleared.
+
+    All member functions may be called concurrently from several threads.
+  */
+  class OPENMS_DLLAPI IsotopePatternCache
+  {
+public:
+
+    /// returns a pointer to the singleton instance
+    static IsotopePatternCache * getInstance();
+
+    /**
+      @brief Returns the distribution of @p count atoms of @p element, restricted to @p max_isotope isotopes
+
+      Equals <tt>element->getIsotopeDistribution() * count</tt> with max isotope set to @p max_isotope.
+    */
+    IsotopeDistribution::ContainerType getElementDistribution(const Element * element, Size count, Size max_isotope);
+
+    /**
+      @brief Returns the averagine distribution of a peptide of weight @p average_weight
+
+      Equals IsotopeDistribution::estimateFromPeptideWeight(@p average_weight) with max isotope set to @p max_isotope.
+    */
+    IsotopeDistribution::ContainerType getAveragineDistribution(DoubleReal average_weight, Size max_isotope);
+
+    /// returns the number of cached distributions
+    Size size() const;
+
+    /// returns the maximal number of cached distributions
+    Size getMaxEntries() const;
+
+    /// sets the maximal number of cached distributions (0 disables caching)
+    void setMaxEntries(Size max_entries);
+
+    /// removes all cached distributions
+    void clear();
+
+protected:
+
+    /// key of element distributions: element, count and max isotope
+    typedef std::pair<const Element *, std::pair<Size, Size> > ElementKey_;
+
+    /// key of averagine distributions: max isotope followed by the element counts
+    typedef std::vector<Size> AveragineKey_;
+
+    /// Default constructor
+    IsotopePatternCache();
+
+    /// Destructor
+    virtual ~IsotopePatternCache();
+
+    /// Copy constructor (not implemented)
+    IsotopePatternCache(const IsotopePatternCache &);
+
+    /// Assignment operator (not implemented)
+    IsotopePatternCache & operator=(const IsotopePatternCache &);
+
+    /// returns if @p element is stored in the ElementDB
+    bool isCacheable_(const Element * element) const;
+
+    /// clears the cache if it is full (must be called inside the critical section)
+    void makeRoom_();
+
+    /// cached element distributions
+    std::map<ElementKey_, IsotopeDistribution::ContainerType> element_distributions_;
+
+    /// cached averagine distributions
+    std::map<AveragineKey_, IsotopeDistribution::ContainerType> averagine_distributions_;
+
+    /// maximal number of cached distributions
+    Size max_entries_;
+
+    /// the averagine elements (C, H, N, O, S)
+    std::vector<const Element *> averagine_elements_;
+
+    /// averagine element count divided by averagine weight (same order as averagine_elements_)
+    std::vector<DoubleReal> averagine_factors_;
+
+  };
+
+} // namespace OpenMS
+
+#endif // OPENMS_CHEMISTRY_ISOTOPEPATTERNCACHE_H
@@ -10,7 +10,9 @@ Element.h
 ElementDB.h
 EmpiricalFormula.h
 EnzymaticDigestion.h
+EnzymaticDigestionCursor.h
 IsotopeDistribution.h
+IsotopePatternCache.h
 ModificationDefinition.h
 ModificationDefinitionsSet.h
 ModificationsDB.h
@@ -0,0 +1,270 @@
+// --------------------------------------------------------------------------
+//                   OpenMS -- Open-Source Mass Spectrometry
+// --------------------------------------------------------------------------
+// Copyright The OpenMS Team -- Eberhard Karls University Tuebingen,
+// ETH Zurich, and Freie Universitaet Berlin 2002-2013.
+//
+// This software is released under a three-clause BSD license:
+//  * Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//  * Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+//  * Neither the name of any author or any participating institution
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+// For a full list of authors, refer to the file AUTHORS.
+// --------------------------------------------------------------------------
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL ANY OF THE AUTHORS OR THE CONTRIBUTING
+// INSTITUTIONS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+// ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// --------------------------------------------------------------------------
+// $Maintainer: Chris Bielow $
+// $Authors: $
+// --------------------------------------------------------------------------
+
+#ifndef OPENMS_DATASTRUCTURES_PEPTIDEMASSINDEX_H
+#define OPENMS_DATASTRUCTURES_PEPTIDEMASSINDEX_H
+
+#include <OpenMS/CONCEPT/Types.h>
+#include <OpenMS/DATASTRUCTURES/DefaultParamHandler.h>
+#include <OpenMS/DATASTRUCTURES/String.h>
+#include <OpenMS/FORMAT/FASTAFile.h>
+
+#include <string>
+#include <utility>
+#include <vector>
+
+class QFile;
+
+namespace OpenMS
+{
+  /**
+    @brief Digestion products of a protein database, sorted by mass and stored in a memory-mappable file
+
+    The suffix array classes (e.g. SuffixArraySeqan) walk a suffix tree for every spectrum
+    and must read their saved structures back into memory completely. This index instead holds
+    one flat entry per digestion product (and per modification variant), sorted by mass, with a
+    back-reference to its protein. Candidates for a precursor mass are the contiguous range of
+    entries found by binary search.
+
+    The index is created once by build() and written with store(). Later runs map the file via
+    load() (no parsing, no copying), so it is ready immediately and the operating system shares
+    the pages between processes. The parameters used for building are stored as well and restored
+    by load(), so callers can check whether a stored index fits their settings:
+
+    @code
+    PeptideMassIndex index;
+    index.setParameters(wanted);
+    if (File::exists(index_file))
+    {
+      index.load(index_file);
+    }
+    if (index.size() == 0 || index.getParameters() != wanted)
+    {
+      index.setParameters(wanted);
+      index.build(proteins);
+      index.store(index_file);
+    }
+    @endcode
+
+    Variable modifications (parameter 'modifications:variable', names as in the ModificationsDB, e.g.
+    'Oxidation (M)') create additional entries with the same sequence range, whose mass includes the
+    summed mass differences of up to 'modifications:max_per_peptide' modified residues. Only modifications
+    which are not restricted to a terminus are supported.
+
+    All const member functions are thread-safe. findByMasses() queries many masses in parallel.
+
+    @htmlinclude OpenMS_PeptideMassIndex.parameters
+
+    @ingroup Datastructures
+  */
+  class OPENMS_DLLAPI PeptideMassIndex :
+    public DefaultParamHandler
+  {
+public:
+
+    /// A digestion product (or one of its modification variants); the layout is part of the file format
+    struct Entry
+    {
+      /// monoisotopic mass of the uncharged peptide, including modification_mass
+      DoubleReal mass;
+      /// summed mass difference of the variable modifications (0 for the unmodified peptide)
+      DoubleReal modification_mass;
+      /// index of the protein
+      UInt protein_index;
+      /// start position of the peptide in the protein
+      UInt start;
+      /// length of the peptide
+      UInt length;
+      /// number of modified residues
+      UInt modification_count;
+    };
+
+    /// Default constructor
+    PeptideMassIndex();
+
+    /// Destructor
+    virtual ~PeptideMassIndex();
+
+    /**
+      @brief Digests @p proteins with the current parameters and builds the index in memory (in parallel)
+
+      @exception Exception::InvalidParameter is thrown if a variable modification is unknown or restricted to a terminus
+    */
+    void build(const std::vector<FASTAFile::FASTAEntry> & proteins);
+
+    /**
+      @brief Writes the index to @p filename
+
+      @exception Exception::UnableToCreateFile is thrown if the file cannot be written
+    */
+    void store(const String & filename) const;
+
+    /**
+      @brief Maps the index stored in @p filename into memory and restores the parameters used for building it
+
+      @exception Exception::FileNotFound is thrown if the file does not exist
+      @exception Exception::FileNotReadable is thrown if the file cannot be read or mapped
+      @exception Exception::ParseError is thrown if the file is not a (compatible) index
+    */
+    void load(const String & filename);
+
+    /// Releases the index (unmaps the file)
+    void clear();
+
+    /// Returns the number of entries
+    Size size() const;
+
+    /// Returns the number of proteins
+    Size getProteinCount() const;
+
+    /**
+      @brief Returns the entry at position @p index (entries are sorted by mass)
+
+      @exception Exception::IndexOverflow is thrown if @p index is out of range
+    */
+    const Entry & getEntry(Size index) const;
+
+    /// Returns the peptide sequence (one-letter code) of @p entry
+    String getPeptide(const Entry & entry) const;
+
+    /**
+      @brief Returns the sequence of the protein with index @p protein_index
+
+      @exception Exception::IndexOverflow is thrown if @p protein_index is out of range
+    */
+    String getProteinSequence(Size protein_index) const;
+
+    /**
+      @brief Returns the identifier (accession) of the protein with index @p protein_index
+
+      @exception Exception::IndexOverflow is thrown if @p protein_index is out of range
+    */
+    String getProteinIdentifier(Size protein_index) const;
+
+    /// Returns the range [first, second) of entries with a mass in [@p mass - @p tolerance, @p mass + @p tolerance]
+    std::pair<Size, Size> findByMass(DoubleReal mass, DoubleReal tolerance) const;
+
+    /**
+      @brief Looks up many masses in parallel
+
+      @p ranges[i] is findByMass(@p masses[i], @p tolerance). The masses do not need to be sorted.
+    */
+    void findByMasses(const std::vector<DoubleReal> & masses, DoubleReal tolerance, std::vector<std::pair<Size, Size> > & ranges) const;
+
+protected:
+
+    /// Header of the index file; entries, offsets and strings follow in this order
+    struct Header_
+    {
+      char magic[8];
+      UInt version;
+      UInt byte_order;
+      UInt64 entry_count;
+      UInt64 protein_count;
+      UInt64 sequence_bytes;
+      UInt64 identifier_bytes;
+      UInt64 modification_bytes;
+      DoubleReal min_mass;
+      DoubleReal max_mass;
+      UInt enzyme;
+      UInt missed_cleavages;
+      UInt max_modifications;
+      UInt reserved;
+    };
+
+    /// A variable modification: residue and mass difference
+    struct Modification_
+    {
+      char residue;
+      DoubleReal mass;
+    };
+
+    /**
+      @brief Appends @p entry and its modification variants (using modifications @p mod_index and following) to @p entries
+
+      @p free_residues holds, indexed by one-letter code, the number of residues of the peptide that are not modified yet.
+      At most @p remaining further modifications are added. Only entries within the mass window are appended.
+    */
+    void addVariants_(const std::vector<Modification_> & modifications, Size mod_index, std::vector<Size> & free_residues, Size remaining, const Entry & entry, std::vector<Entry> & entries) const;
+
+    /// Returns the variable modifications given by the parameters
+    std::vector<Modification_> getModifications_() const;
+
+    /// Points the accessors to the owned vectors (after build())
+    void useOwnedData_();
+
+    // docu in base class
+    void updateMembers_();
+
+    /// Mass window and digestion settings
+    DoubleReal min_mass_;
+    DoubleReal max_mass_;
+    Size missed_cleavages_;
+    Size max_modifications_;
+
+    /// Entries sorted by mass (owned or mapped)
+    const Entry * entries_;
+    Size entry_count_;
+    /// Protein sequence and identifier offsets (protein_count + 1 each) into sequences_ and identifiers_
+    const UInt64 * sequence_offsets_;
+    const UInt64 * identifier_offsets_;
+    Size protein_count_;
+    /// Concatenated protein sequences and identifiers
+    const char * sequences_;
+    const char * identifiers_;
+
+    /// Data of a built index
+    std::vector<Entry> owned_entries_;
+    std::vector<UInt64> owned_sequence_offsets_;
+    std::vector<UInt64> owned_identifier_offsets_;
+    std::string owned_sequences_;
+    std::string owned_identifiers_;
+
+    /// The mapped file of a loaded index
+    QFile * file_;
+    const char * data_;
+
+private:
+
+    /// Not implemented (may own a file mapping)
+    PeptideMassIndex(const PeptideMassIndex & rhs);
+
+    /// Not implemented (may own a file mapping)
+    PeptideMassIndex & operator=(const PeptideMassIndex & rhs);
+
+  };
+
+} // namespace OpenMS
+
+#endif // OPENMS_DATASTRUCTURES_PEPTIDEMASSINDEX_H
@@ -31,6 +31,7 @@ Map.h
 MassExplainer.h
 Matrix.h
 Param.h
+PeptideMassIndex.h
 QTCluster.h
 SeqanIncludeWrapper.h
 SparseVector.h
@@ -36,6 +36,7 @@
 #define OPENMS_FILTERING_TRANSFORMERS_NLARGEST_H
 
 #include <OpenMS/KERNEL/StandardTypes.h>
+#include <OpenMS/KERNEL/PeakArrays.h>
 #include <OpenMS/DATASTRUCTURES/DefaultParamHandler.h>
 #include <OpenMS/KERNEL/StandardTypes.h>
 
@@ -88,6 +89,14 @@ public:
 
     void filterPeakMap(PeakMap & exp);
 
+    /**
+      @brief Removes all but the n largest peaks
+
+      In contrast to filterSpectrum(), the remaining peaks keep their order. Of several peaks
+      with the intensity of the n-th largest peak, the first ones are kept.
+    */
+    void filterPeakArrays(PeakArrays & arrays);
+
     //TODO reimplement DefaultParamHandler::updateMembers_()
 
     // @}
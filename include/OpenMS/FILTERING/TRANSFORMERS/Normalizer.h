@@ -36,6 +36,7 @@
 #define OPENMS_FILTERING_TRANSFORMERS_NORMALIZER_H
 
 #include <OpenMS/KERNEL/StandardTypes.h>
+#include <OpenMS/KERNEL/PeakArrays.h>
 
 #include <OpenMS/DATASTRUCTURES/DefaultParamHandler.h>
 
@@ -124,6 +125,8 @@ public:
     void filterPeakSpectrum(PeakSpectrum & spectrum);
     ///
     void filterPeakMap(PeakMap & exp);
+    /// Same as filterSpectrum(), working on the intensity array only
+    void filterPeakArrays(PeakArrays & arrays);
 
     //TODO reimplement DefaultParamHandler::updateMembers_()
 
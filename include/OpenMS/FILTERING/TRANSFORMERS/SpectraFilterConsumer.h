@@ -0,0 +1,172 @@
+// --------------------------------------------------------------------------
+//                   OpenMS -- Open-Source Mass Spectrometry
+// --------------------------------------------------------------------------
+// Copyright The OpenMS Team -- Eberhard Karls University Tuebingen,
+// ETH Zurich, and Freie Universitaet Berlin 2002-2013.
+//
+// This software is released under a three-clause BSD license:
+//  * Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//  * Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+//  * Neither the name of any author or any participating institution
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+// For a full list of authors, refer to the file AUTHORS.
+// --------------------------------------------------------------------------
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL ANY OF THE AUTHORS OR THE CONTRIBUTING
+// INSTITUTIONS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+// ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// --------------------------------------------------------------------------
+// $Maintainer: Mathias Walzer $
+// $Authors: $
+// --------------------------------------------------------------------------
+//
+#ifndef OPENMS_FILTERING_TRANSFORMERS_SPECTRAFILTERCONSUMER_H
+#define OPENMS_FILTERING_TRANSFORMERS_SPECTRAFILTERCONSUMER_H
+
+#include <OpenMS/CONCEPT/Exception.h>
+#include <OpenMS/CONCEPT/LogStream.h>
+#include <OpenMS/FILTERING/TRANSFORMERS/SpectraFilterDriver.h>
+#include <OpenMS/INTERFACES/IMSDataConsumer.h>
+
+#include <algorithm>
+
+namespace OpenMS
+{
+  /**
+    @brief Consumer that applies a spectrum preprocessing filter while the data is read
+
+    Spectra are collected in batches of @p batch_size, filtered in parallel
+    using SpectraFilterDriver and then passed on (in their original order) to
+    the next consumer, e.g. an MSDataWritingConsumer. This allows filtering a
+    file with MzMLFile::transform without holding the whole map in memory.
+
+    Chromatograms are passed on unchanged. Pending spectra are passed on
+    before each chromatogram, so the order of the data is preserved.
+
+    @note Call flush() after the last spectrum was consumed. The destructor
+    passes on remaining spectra as well, but it cannot throw: errors of the
+    filter or of the next consumer are only logged there.
+
+    @ingroup SpectraPreprocessers
+  */
+  template <typename FilterType>
+  class SpectraFilterConsumer :
+    public Interfaces::IMSDataConsumer<>
+  {
+public:
+
+    /**
+      @brief Constructor
+
+      @param filter The filter to apply (it is copied)
+      @param consumer The consumer that receives the filtered spectra (not owned)
+      @param batch_size Number of spectra that are filtered together
+
+      @exception Exception::NullPointer is thrown if @p consumer is null
+    */
+    SpectraFilterConsumer(const FilterType & filter, Interfaces::IMSDataConsumer<> * consumer, Size batch_size = 1000) :
+      filter_(filter),
+      consumer_(consumer),
+      batch_size_(batch_size == 0 ? 1 : batch_size)
+    {
+      if (consumer_ == 0)
+      {
+        throw Exception::NullPointer(__FILE__, __LINE__, __PRETTY_FUNCTION__);
+      }
+    }
+
+    /// Destructor (passes on pending spectra, errors are logged)
+    virtual ~SpectraFilterConsumer()
+    {
+      try
+      {
+        flush();
+      }
+      catch (Exception::BaseException & e)
+      {
+        LOG_ERROR << "SpectraFilterConsumer: pending spectra could not be passed on: " << e.what() << std::endl;
+      }
+      catch (...)
+      {
+        LOG_ERROR << "SpectraFilterConsumer: pending spectra could not be passed on (unknown error)" << std::endl;
+      }
+    }
+
+    /// @name IMSDataConsumer interface
+    //@{
+    virtual void setExpectedSize(Size expectedSpectra, Size expectedChromatograms)
+    {
+      batch_.reserve(std::min(expectedSpectra, batch_size_));
+      consumer_->setExpectedSize(expectedSpectra, expectedChromatograms);
+    }
+
+    virtual void setExperimentalSettings(const ExperimentalSettings & exp)
+    {
+      consumer_->setExperimentalSettings(exp);
+    }
+
+    virtual void consumeSpectrum(SpectrumType & s)
+    {
+      batch_.push_back(s);
+      if (batch_.size() >= batch_size_)
+      {
+        flush();
+      }
+    }
+
+    virtual void consumeChromatogram(ChromatogramType & c)
+    {
+      flush();
+      consumer_->consumeChromatogram(c);
+    }
+    //@}
+
+    /// Filters the pending spectra and passes them on to the next consumer
+    void flush()
+    {
+      if (batch_.empty()) return;
+
+      SpectraFilterDriver<FilterType>::filterSpectra(filter_, batch_);
+      for (Size i = 0; i < batch_.size(); ++i)
+      {
+        consumer_->consumeSpectrum(batch_[i]);
+      }
+      batch_.clear();
+    }
+
+protected:
+
+    /// The filter (copied for each thread by the driver)
+    FilterType filter_;
+    /// The next consumer
+    Interfaces::IMSDataConsumer<> * consumer_;
+    /// Number of spectra that are filtered together
+    Size batch_size_;
+    /// Pending spectra
+    std::vector<SpectrumType> batch_;
+
+private:
+
+    /// Not implemented
+    SpectraFilterConsumer();
+    /// Not implemented
+    SpectraFilterConsumer(const SpectraFilterConsumer &);
+    /// Not implemented
+    SpectraFilterConsumer & operator=(const SpectraFilterConsumer &);
+  };
+
+}
+
+#endif //OPENMS_FILTERING_TRANSFORMERS_SPECTRAFILTERCONSUMER_H
@@ -0,0 +1,121 @@
+// --------------------------------------------------------------------------
+//                   OpenMS -- Open-Source Mass Spectrometry
+// --------------------------------------------------------------------------
+// Copyright The OpenMS Team -- Eberhard Karls University Tuebingen,
+// ETH Zurich, and Freie Universitaet Berlin 2002-2013.
+//
+// This software is released under a three-clause BSD license:
+//  * Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//  * Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+//  * Neither the name of any author or any participating institution
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+// For a full list of authors, refer to the file AUTHORS.
+// --------------------------------------------------------------------------
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL ANY OF THE AUTHORS OR THE CONTRIBUTING
+// INSTITUTIONS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+// ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// --------------------------------------------------------------------------
+// $Maintainer: Mathias Walzer $
+// $Authors: $
+// --------------------------------------------------------------------------
+//
+#ifndef OPENMS_FILTERING_TRANSFORMERS_SPECTRAFILTERDRIVER_H
+#define OPENMS_FILTERING_TRANSFORMERS_SPECTRAFILTERDRIVER_H
+
+#include <OpenMS/KERNEL/StandardTypes.h>
+
+#include <algorithm>
+#include <vector>
+
+namespace OpenMS
+{
+  /**
+    @brief Applies a spectrum preprocessing filter to many spectra in parallel
+
+    The filters of this directory (NLargest, ThresholdMower, WindowMower, ...)
+    treat every spectrum independently. This driver distributes the spectra
+    over the available threads (if OpenMP is enabled). Each thread works on its
+    own copy of the filter, as the filterSpectrum() methods store their
+    parameters in members and are therefore not safe to call concurrently.
+
+    @p FilterType has to be copy constructible and has to provide
+    <tt>void filterPeakSpectrum(PeakSpectrum&)</tt>.
+
+    Exceptions must not leave the parallel region. If the filter throws, the
+    first failing spectrum is filtered again serially after all threads have
+    finished, which passes on the original exception. The filters validate
+    their settings before changing a spectrum, so the second run sees the
+    same input.
+
+    @ingroup SpectraPreprocessers
+  */
+  template <typename FilterType>
+  class SpectraFilterDriver
+  {
+public:
+
+    /// Filters all spectra of @p exp
+    static void filterPeakMap(const FilterType & filter, PeakMap & exp)
+    {
+      filterSpectra(filter, exp.getSpectra());
+    }
+
+    /// Filters all spectra of @p spectra
+    static void filterSpectra(const FilterType & filter, std::vector<PeakSpectrum> & spectra)
+    {
+      if (spectra.empty()) return;
+
+      Size failed_index = spectra.size();
+
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+      {
+        // each thread works on its own instance (see class documentation)
+        FilterType local_filter(filter);
+
+        // Only in OpenMP 3.0 are unsigned loop variables allowed
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic, 16)
+#endif
+        for (SignedSize i = 0; i < (SignedSize)spectra.size(); ++i)
+        {
+          try
+          {
+            local_filter.filterPeakSpectrum(spectra[i]);
+          }
+          catch (...)
+          {
+#ifdef _OPENMP
+#pragma omp critical (SpectraFilterDriver_error)
+#endif
+            failed_index = std::min(failed_index, (Size)i);
+          }
+        }
+      }
+
+      if (failed_index < spectra.size())
+      {
+        FilterType local_filter(filter);
+        local_filter.filterPeakSpectrum(spectra[failed_index]);
+      }
+    }
+
+  };
+
+}
+
+#endif //OPENMS_FILTERING_TRANSFORMERS_SPECTRAFILTERDRIVER_H
@@ -36,6 +36,7 @@
 #define OPENMS_FILTERING_TRANSFORMERS_SQRTMOWER_H
 
 #include <OpenMS/KERNEL/StandardTypes.h>
+#include <OpenMS/KERNEL/PeakArrays.h>
 #include <OpenMS/DATASTRUCTURES/DefaultParamHandler.h>
 
 #include <cmath>
@@ -91,6 +92,9 @@ public:
 
     void filterPeakMap(PeakMap & exp);
 
+    /// Same as filterSpectrum(), working on the intensity array only
+    void filterPeakArrays(PeakArrays & arrays);
+
     //TODO reimplement DefaultParamHandler::updateMembers_()
 
     // @}
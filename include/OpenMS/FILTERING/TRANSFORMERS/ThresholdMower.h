@@ -36,6 +36,7 @@
 #define OPENMS_FILTERING_TRANSFORMERS_THRESHOLDMOWER_H
 
 #include <OpenMS/KERNEL/StandardTypes.h>
+#include <OpenMS/KERNEL/PeakArrays.h>
 #include <OpenMS/DATASTRUCTURES/DefaultParamHandler.h>
 
 namespace OpenMS
@@ -90,6 +91,9 @@ public:
 
     void filterPeakMap(PeakMap & exp);
 
+    /// Removes all peaks below the threshold (the remaining peaks keep their order)
+    void filterPeakArrays(PeakArrays & arrays);
+
     //TODO reimplement DefaultParamHandler::updateMembers_()
 
 private:
@@ -20,6 +20,8 @@ Normalizer.h
 ParentPeakMower.h
 PeakMarker.h
 Scaler.h
+SpectraFilterConsumer.h
+SpectraFilterDriver.h
 SqrtMower.h
 TICFilter.h
 ThresholdMower.h
@@ -0,0 +1,231 @@
+// --------------------------------------------------------------------------
+//                   OpenMS -- Open-Source Mass Spectrometry
+// --------------------------------------------------------------------------
+// Copyright The OpenMS Team -- Eberhard Karls University Tuebingen,
+// ETH Zurich, and Freie Universitaet Berlin 2002-2013.
+//
+// This software is released under a three-clause BSD license:
+//  * Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//  * Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+//  * Neither the name of any author or any participating institution
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+// For a full list of authors, refer to the file AUTHORS.
+// --------------------------------------------------------------------------
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL ANY OF THE AUTHORS OR THE CONTRIBUTING
+// INSTITUTIONS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+// ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// --------------------------------------------------------------------------
+// $Maintainer: Sandro Andreotti $
+// $Authors: $
+// --------------------------------------------------------------------------
+
+#ifndef OPENMS_FORMAT_INDEXEDFASTAFILE_H
+#define OPENMS_FORMAT_INDEXEDFASTAFILE_H
+
+#include <OpenMS/CONCEPT/Exception.h>
+#include <OpenMS/DATASTRUCTURES/String.h>
+#include <OpenMS/FORMAT/FASTAFile.h>
+
+#include <boost/unordered_map.hpp>
+
+#include <string>
+#include <vector>
+
+class QFile;
+
+namespace OpenMS
+{
+  /**
+    @brief Random access to the entries of a FASTA file
+
+    In contrast to FASTAFile::load, which parses the whole database into
+    memory, this class memory-maps the FASTA file and keeps only the byte
+    offsets of the records and a hash of the protein identifiers
+    (accessions). Entries are parsed on demand, either by position or by
+    accession.
+
+    The index (record offsets and identifiers) can be written next to the
+    database (see getIndexFilename()) and is reused by subsequent runs as long as size and
+    modification time of the FASTA file did not change. If the index file
+    cannot be written (e.g. read-only database directory), the index is
+    simply kept in memory.
+
+    Identifiers and descriptions are split exactly as in FASTAFile::load.
+
+    After openFile() all const member functions only read from the mapped
+    file and are therefore thread-safe, e.g. chunks of entries can be
+    processed in an OpenMP loop:
+
+    @code
+    IndexedFASTAFile db("proteins.fasta");
+    #pragma omp parallel for
+    for (SignedSize i = 0; i < (SignedSize)db.size(); ++i)
+    {
+      FASTAFile::FASTAEntry entry;
+      db.getEntry(i, entry);
+      ...
+    }
+    @endcode
+  */
+  class OPENMS_DLLAPI IndexedFASTAFile
+  {
+public:
+
+    /// FASTA entry type
+    typedef FASTAFile::FASTAEntry FASTAEntry;
+
+    /// Default constructor
+    IndexedFASTAFile();
+
+    /**
+      @brief Constructor which opens the file @p filename
+
+      @see openFile()
+    */
+    explicit IndexedFASTAFile(const String& filename, bool use_index_file = true);
+
+    /// Destructor
+    virtual ~IndexedFASTAFile();
+
+    /**
+      @brief Maps the FASTA file @p filename into memory and builds (or reuses) the offset index
+
+      @param filename The FASTA file
+      @param use_index_file Read the index from getIndexFilename(filename) if it is up-to-date and write it otherwise
+
+      @exception Exception::FileNotFound is thrown if the file does not exists.
+      @exception Exception::FileNotReadable is thrown if the file cannot be read or mapped.
+      @exception Exception::ParseError is thrown if the file does not start with a FASTA header.
+    */
+    void openFile(const String& filename, bool use_index_file = true);
+
+    /// Unmaps the file and clears the index
+    void close();
+
+    /// Returns if a file is currently opened
+    bool isOpen() const;
+
+    /// Returns the name of the opened file
+    const String& getFilename() const;
+
+    /// Returns the number of entries
+    Size size() const;
+
+    /**
+      @brief Parses the entry at position @p index
+
+      @exception Exception::IndexOverflow is thrown if @p index is out of range
+    */
+    void getEntry(Size index, FASTAEntry& entry) const;
+
+    /**
+      @brief Parses only the sequence of the entry at position @p index
+
+      @exception Exception::IndexOverflow is thrown if @p index is out of range
+    */
+    String getSequence(Size index) const;
+
+    /**
+      @brief Returns the position of the entry with the identifier (accession) @p identifier
+
+      @return true if the identifier exists in the database, false otherwise
+    */
+    bool findIndex(const String& identifier, Size& index) const;
+
+    /**
+      @brief Parses the entry with the identifier (accession) @p identifier
+
+      @return true if the identifier exists in the database, false otherwise
+    */
+    bool getEntry(const String& identifier, FASTAEntry& entry) const;
+
+    /**
+      @brief Parses the entries in the range [@p first, @p last) and stores them in @p entries
+
+      The range is clipped to the number of entries.
+    */
+    void getChunk(Size first, Size last, std::vector<FASTAEntry>& entries) const;
+
+    /// Returns the name of the index file used for @p fasta_filename
+    static String getIndexFilename(const String& fasta_filename);
+
+protected:
+
+    /// Byte range of a FASTA record (starting with '>')
+    struct Record_
+    {
+      Size offset;
+      Size length;
+    };
+
+    /// Scans the mapped file for record starts
+    void buildIndex_();
+
+    /// Reads the index (records and accession hash) from @p index_filename, returns false if it is missing, outdated or corrupt
+    bool loadIndex_(const String& index_filename);
+
+    /// Writes the index to @p index_filename, returns false if the file could not be written
+    bool storeIndex_(const String& index_filename) const;
+
+    /// Fills the accession hash from the record headers
+    void buildAccessionIndex_();
+
+    /// Parses a non-negative decimal number, returns false for anything else (including overflow)
+    static bool parseSize_(const std::string& text, Size& value);
+
+    /// Extracts identifier and description from the header line of @p record
+    void parseHeader_(const Record_& record, String& identifier, String& description) const;
+
+    /// Extracts the sequence (without whitespaces) from @p record
+    void parseSequence_(const Record_& record, String& sequence) const;
+
+    /// Returns the record at @p index or throws Exception::IndexOverflow
+    const Record_& getRecord_(Size index) const;
+
+    /// Returns a fingerprint of the FASTA file (size and modification time) which is stored in the index
+    String getFileFingerprint_() const;
+
+    /// Name of the opened file
+    String filename_;
+
+    /// The mapped file
+    QFile* file_;
+
+    /// Start of the mapped data
+    const char* data_;
+
+    /// Size of the mapped data
+    Size data_size_;
+
+    /// Byte ranges of all records
+    std::vector<Record_> records_;
+
+    /// Identifier to record index
+    boost::unordered_map<std::string, Size> accession_index_;
+
+private:
+
+    /// Not implemented (owns the file mapping)
+    IndexedFASTAFile(const IndexedFASTAFile& rhs);
+
+    /// Not implemented (owns the file mapping)
+    IndexedFASTAFile& operator=(const IndexedFASTAFile& rhs);
+
+  };
+
+} // namespace OpenMS
+
+#endif // OPENMS_FORMAT_INDEXEDFASTAFILE_H
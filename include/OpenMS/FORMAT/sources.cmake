@@ -41,6 +41,7 @@ FileHandler.h
 GzipIfstream.h
 GzipInputStream.h
 IdXMLFile.h
+IndexedFASTAFile.h
 IndexedMzMLFile.h
 IndexedMzMLFileLoader.h
 InspectInfile.h
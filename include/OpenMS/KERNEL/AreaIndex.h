@@ -0,0 +1,306 @@
+// --------------------------------------------------------------------------
+//                   OpenMS -- Open-Source Mass Spectrometry
+// --------------------------------------------------------------------------
+// Copyright The OpenMS Team -- Eberhard Karls University Tuebingen,
+// ETH Zurich, and Freie Universitaet Berlin 2002-2013.
+//
+// This software is released under a three-clause BSD license:
+//  * Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//  * Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+//  * Neither the name of any author or any participating institution
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+// For a full list of authors, refer to the file AUTHORS.
+// --------------------------------------------------------------------------
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL ANY OF THE AUTHORS OR THE CONTRIBUTING
+// INSTITUTIONS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+// ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// --------------------------------------------------------------------------
+// $Maintainer: Stephan Aiche $
+// $Authors: $
+// --------------------------------------------------------------------------
+
+#ifndef OPENMS_KERNEL_AREAINDEX_H
+#define OPENMS_KERNEL_AREAINDEX_H
+
+#include <OpenMS/CONCEPT/Types.h>
+#include <OpenMS/CONCEPT/Macros.h>
+#include <OpenMS/KERNEL/PeakIndex.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+namespace OpenMS
+{
+  /**
+    @brief Build-once index for fast RT/m/z range queries on a peak map
+
+    MSExperiment::areaBegin() searches the RT range and, for every spectrum in it, the m/z range
+    with a binary search. Code that issues many small area queries (e.g. "peaks near (rt, mz)")
+    pays these searches over and over again. This index caches the RT values of the spectra and
+    divides the m/z range of the map into equally wide buckets, storing for every spectrum the
+    position of the first peak of every bucket. A query then only needs a lookup plus a short
+    linear scan (@p peaks_per_bucket peaks on average) per spectrum, so its running time is
+    proportional to the number of spectra in the RT range plus the number of reported peaks.
+
+    As AreaIterator, the index only covers spectra with MS level 1. Results are reported as
+    PeakIndex (spectrum index and peak index in the map).
+
+    @note The map must be sorted by RT and m/z and must not be modified while the index is used
+    (it keeps a pointer to the map). Call build() again after changing the map.
+
+    @ingroup Kernel
+  */
+  template <typename MapType>
+  class AreaIndex
+  {
+public:
+    /// Coordinate type
+    typedef DoubleReal CoordinateType;
+
+    /// Default constructor (creates an empty index)
+    AreaIndex() :
+      map_(0),
+      spectra_(),
+      rts_(),
+      mz_min_(0.0),
+      bucket_width_(1.0),
+      bucket_count_(0),
+      bucket_begin_(),
+      peak_count_(0)
+    {
+    }
+
+    /// Constructor that builds the index for @p map
+    explicit AreaIndex(const MapType & map, Size peaks_per_bucket = 8) :
+      map_(0),
+      spectra_(),
+      rts_(),
+      mz_min_(0.0),
+      bucket_width_(1.0),
+      bucket_count_(0),
+      bucket_begin_(),
+      peak_count_(0)
+    {
+      build(map, peaks_per_bucket);
+    }
+
+    /**
+      @brief Builds the index for @p map
+
+      @p peaks_per_bucket is the average number of peaks per m/z bucket and spectrum, i.e. it
+      trades memory (one UInt per bucket and spectrum) against the length of the linear scans.
+    */
+    void build(const MapType & map, Size peaks_per_bucket = 8)
+    {
+      OPENMS_PRECONDITION(map.isSorted(true), "Experiment is not sorted by RT and m/z! Using AreaIndex will give invalid results!")
+
+      clear();
+      map_ = &map;
+
+      CoordinateType mz_max = -(std::numeric_limits<CoordinateType>::max)();
+      mz_min_ = (std::numeric_limits<CoordinateType>::max)();
+      for (Size s = 0; s < map.size(); ++s)
+      {
+        if (map[s].getMSLevel() != 1)
+        {
+          continue;
+        }
+        spectra_.push_back(s);
+        rts_.push_back(map[s].getRT());
+        if (!map[s].empty())
+        {
+          mz_min_ = std::min(mz_min_, (CoordinateType)map[s].front().getMZ());
+          mz_max = std::max(mz_max, (CoordinateType)map[s].back().getMZ());
+          peak_count_ += map[s].size();
+        }
+      }
+
+      if (peak_count_ == 0)
+      {
+        mz_min_ = 0.0;
+        bucket_width_ = 1.0;
+        bucket_count_ = 0;
+        return;
+      }
+
+      bucket_count_ = std::max(Size(1), peak_count_ / (spectra_.size() * std::max(Size(1), peaks_per_bucket)));
+      bucket_width_ = (mz_max - mz_min_) / bucket_count_;
+      if (bucket_width_ <= 0.0)
+      {
+        bucket_width_ = 1.0;
+      }
+
+      // for every spectrum: first peak with m/z >= lower bucket boundary (plus the spectrum size as last entry)
+      bucket_begin_.resize(spectra_.size() * (bucket_count_ + 1));
+      for (Size i = 0; i < spectra_.size(); ++i)
+      {
+        const typename MapType::SpectrumType & spectrum = map[spectra_[i]];
+        UInt * begin = &bucket_begin_[i * (bucket_count_ + 1)];
+        Size p = 0;
+        for (Size b = 0; b < bucket_count_; ++b)
+        {
+          const CoordinateType boundary = mz_min_ + b * bucket_width_;
+          while (p < spectrum.size() && spectrum[p].getMZ() < boundary)
+          {
+            ++p;
+          }
+          begin[b] = (UInt)p;
+        }
+        begin[bucket_count_] = (UInt)spectrum.size();
+      }
+    }
+
+    /// Removes the index
+    void clear()
+    {
+      map_ = 0;
+      spectra_.clear();
+      rts_.clear();
+      mz_min_ = 0.0;
+      bucket_width_ = 1.0;
+      bucket_count_ = 0;
+      bucket_begin_.clear();
+      peak_count_ = 0;
+    }
+
+    /// Returns the number of indexed peaks
+    Size getPeakCount() const
+    {
+      return peak_count_;
+    }
+
+    /// Returns the number of m/z buckets per spectrum
+    Size getBucketCount() const
+    {
+      return bucket_count_;
+    }
+
+    /**
+      @brief Stores the indices of all peaks with RT in [@p min_rt, @p max_rt] and m/z in [@p min_mz, @p max_mz] in @p result
+
+      The peaks are reported in the same order as by MSExperiment::areaBeginConst().
+    */
+    void getPeaksInArea(CoordinateType min_rt, CoordinateType max_rt, CoordinateType min_mz, CoordinateType max_mz, std::vector<PeakIndex> & result) const
+    {
+      OPENMS_PRECONDITION(min_rt <= max_rt, "Swapped RT range boundaries!")
+      OPENMS_PRECONDITION(min_mz <= max_mz, "Swapped MZ range boundaries!")
+
+      result.clear();
+      if (peak_count_ == 0)
+      {
+        return;
+      }
+
+      Size first = std::lower_bound(rts_.begin(), rts_.end(), min_rt) - rts_.begin();
+      Size last = std::upper_bound(rts_.begin(), rts_.end(), max_rt) - rts_.begin();
+      for (Size i = first; i < last; ++i)
+      {
+        const typename MapType::SpectrumType & spectrum = (*map_)[spectra_[i]];
+        for (Size p = mzBegin_(i, min_mz); p < spectrum.size() && spectrum[p].getMZ() <= max_mz; ++p)
+        {
+          result.push_back(PeakIndex(spectra_[i], p));
+        }
+      }
+    }
+
+    /**
+      @brief Returns the peak closest to (@p rt, @p mz) within the given tolerances
+
+      The distance is measured in units of the tolerances, i.e. (drt / rt_tolerance)^2 + (dmz / mz_tolerance)^2.
+      A tolerance of 0 only accepts exact matches in that dimension. If there is no peak within the
+      tolerances, an invalid PeakIndex is returned.
+    */
+    PeakIndex findNearest(CoordinateType rt, CoordinateType mz, CoordinateType rt_tolerance, CoordinateType mz_tolerance) const
+    {
+      PeakIndex nearest;
+      if (peak_count_ == 0 || rt_tolerance < 0.0 || mz_tolerance < 0.0)
+      {
+        return nearest;
+      }
+
+      CoordinateType min_distance = (std::numeric_limits<CoordinateType>::max)();
+      Size first = std::lower_bound(rts_.begin(), rts_.end(), rt - rt_tolerance) - rts_.begin();
+      Size last = std::upper_bound(rts_.begin(), rts_.end(), rt + rt_tolerance) - rts_.begin();
+      for (Size i = first; i < last; ++i)
+      {
+        const typename MapType::SpectrumType & spectrum = (*map_)[spectra_[i]];
+        const CoordinateType rt_distance = (rt_tolerance > 0.0) ? (rts_[i] - rt) / rt_tolerance : 0.0;
+        for (Size p = mzBegin_(i, mz - mz_tolerance); p < spectrum.size() && spectrum[p].getMZ() <= mz + mz_tolerance; ++p)
+        {
+          const CoordinateType mz_distance = (mz_tolerance > 0.0) ? (spectrum[p].getMZ() - mz) / mz_tolerance : 0.0;
+          const CoordinateType distance = rt_distance * rt_distance + mz_distance * mz_distance;
+          if (distance < min_distance)
+          {
+            min_distance = distance;
+            nearest = PeakIndex(spectra_[i], p);
+          }
+        }
+      }
+      return nearest;
+    }
+
+protected:
+    /// Returns the position of the first peak with m/z >= @p mz in the @p i-th indexed spectrum
+    Size mzBegin_(Size i, CoordinateType mz) const
+    {
+      const typename MapType::SpectrumType & spectrum = (*map_)[spectra_[i]];
+      const UInt * begin = &bucket_begin_[i * (bucket_count_ + 1)];
+
+      Size p;
+      if (mz <= mz_min_)
+      {
+        p = 0;
+      }
+      else
+      {
+        CoordinateType bucket = std::floor((mz - mz_min_) / bucket_width_);
+        p = (bucket >= (CoordinateType)bucket_count_) ? begin[bucket_count_] : begin[(Size)bucket];
+      }
+      // correct for rounding at the bucket boundaries
+      while (p > 0 && spectrum[p - 1].getMZ() >= mz)
+      {
+        --p;
+      }
+      while (p < spectrum.size() && spectrum[p].getMZ() < mz)
+      {
+        ++p;
+      }
+      return p;
+    }
+
+    /// The indexed map
+    const MapType * map_;
+    /// Indices of the indexed (MS1) spectra in the map
+    std::vector<Size> spectra_;
+    /// RTs of the indexed spectra
+    std::vector<CoordinateType> rts_;
+    /// Lower m/z boundary of the first bucket
+    CoordinateType mz_min_;
+    /// Width of the m/z buckets
+    CoordinateType bucket_width_;
+    /// Number of m/z buckets
+    Size bucket_count_;
+    /// First peak of every bucket (bucket_count_ + 1 entries per indexed spectrum)
+    std::vector<UInt> bucket_begin_;
+    /// Number of indexed peaks
+    Size peak_count_;
+  };
+
+} // namespace OpenMS
+
+#endif // OPENMS_KERNEL_AREAINDEX_H
@@ -0,0 +1,169 @@
+// --------------------------------------------------------------------------
+//                   OpenMS -- Open-Source Mass Spectrometry
+// --------------------------------------------------------------------------
+// Copyright The OpenMS Team -- Eberhard Karls University Tuebingen,
+// ETH Zurich, and Freie Universitaet Berlin 2002-2013.
+//
+// This software is released under a three-clause BSD license:
+//  * Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//  * Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+//  * Neither the name of any author or any participating institution
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+// For a full list of authors, refer to the file AUTHORS.
+// --------------------------------------------------------------------------
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL ANY OF THE AUTHORS OR THE CONTRIBUTING
+// INSTITUTIONS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+// ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// --------------------------------------------------------------------------
+// $Maintainer: Stephan Aiche $
+// $Authors: $
+// --------------------------------------------------------------------------
+
+#ifndef OPENMS_KERNEL_PEAKARRAYS_H
+#define OPENMS_KERNEL_PEAKARRAYS_H
+
+#include <OpenMS/CONCEPT/Types.h>
+
+#include <vector>
+
+namespace OpenMS
+{
+  /**
+    @brief Structure-of-arrays storage for the peaks of a spectrum
+
+    MSSpectrum stores its peaks as an array of structs (e.g. Peak1D), so code that only
+    needs the intensities (or only the m/z values) strides over the other members. PeakArrays
+    keeps m/z values and intensities in two separate contiguous arrays instead. Loops over
+    one of them are compact and can be vectorized by the compiler, which is what the
+    filterPeakArrays() methods of the spectrum filters (e.g. ThresholdMower, NLargest,
+    Normalizer, SqrtMower) make use of.
+
+    Both arrays use DoubleReal, which matches the binary data arrays of OpenSwath::Spectrum:
+    OpenSwathDataAccessHelper can hand the arrays over to an OpenSwath spectrum (and back)
+    without copying them.
+
+    Use assign() and copyTo() to convert from and to an MSSpectrum.
+
+    @note The m/z array and the intensity array always need to have the same size. Only peak
+    positions and intensities are stored, meta data of the spectrum is not.
+
+    @ingroup Kernel
+  */
+  class OPENMS_DLLAPI PeakArrays
+  {
+public:
+    /// Array type
+    typedef std::vector<DoubleReal> ArrayType;
+
+    /// Default constructor
+    PeakArrays();
+
+    /// Constructor from a spectrum (see assign())
+    template <typename SpectrumType>
+    explicit PeakArrays(const SpectrumType & spectrum) :
+      mz_(),
+      intensity_()
+    {
+      assign(spectrum);
+    }
+
+    /// Copy constructor
+    PeakArrays(const PeakArrays & source);
+
+    /// Destructor
+    ~PeakArrays();
+
+    /// Assignment operator
+    PeakArrays & operator=(const PeakArrays & source);
+
+    /// Equality operator
+    bool operator==(const PeakArrays & rhs) const;
+
+    /// Inequality operator
+    bool operator!=(const PeakArrays & rhs) const;
+
+    /// Replaces the content by the m/z values and intensities of the peaks of @p spectrum
+    template <typename SpectrumType>
+    void assign(const SpectrumType & spectrum)
+    {
+      mz_.resize(spectrum.size());
+      intensity_.resize(spectrum.size());
+      for (Size i = 0; i < spectrum.size(); ++i)
+      {
+        mz_[i] = spectrum[i].getMZ();
+        intensity_[i] = spectrum[i].getIntensity();
+      }
+    }
+
+    /**
+      @brief Writes the peaks to @p spectrum
+
+      The spectrum is resized to size() and m/z and intensity of all its peaks are overwritten.
+      Meta data of the spectrum (RT, MS level, ...) is kept. If the number of peaks changed, the
+      data arrays (float, string and integer) of the spectrum are no longer valid and have to be
+      adapted by the caller.
+    */
+    template <typename SpectrumType>
+    void copyTo(SpectrumType & spectrum) const
+    {
+      spectrum.resize(mz_.size());
+      for (Size i = 0; i < mz_.size(); ++i)
+      {
+        spectrum[i].setMZ(mz_[i]);
+        spectrum[i].setIntensity(intensity_[i]);
+      }
+    }
+
+    /// Returns the number of peaks
+    Size size() const;
+
+    /// Returns if there are no peaks
+    bool empty() const;
+
+    /// Removes all peaks
+    void clear();
+
+    /// Reserves memory for @p n peaks
+    void reserve(Size n);
+
+    /// Appends a peak
+    void push_back(DoubleReal mz, DoubleReal intensity);
+
+    /// Swaps the content with @p rhs (no copying of peaks)
+    void swap(PeakArrays & rhs);
+
+    ///@name Array accessors
+    //@{
+    /// Mutable access to the m/z array (must not be resized independently of the intensity array)
+    ArrayType & getMZArray();
+    /// Non-mutable access to the m/z array
+    const ArrayType & getMZArray() const;
+    /// Mutable access to the intensity array (must not be resized independently of the m/z array)
+    ArrayType & getIntensityArray();
+    /// Non-mutable access to the intensity array
+    const ArrayType & getIntensityArray() const;
+    //@}
+
+protected:
+    /// m/z values
+    ArrayType mz_;
+    /// intensities
+    ArrayType intensity_;
+  };
+
+} // namespace OpenMS
+
+#endif // OPENMS_KERNEL_PEAKARRAYS_H
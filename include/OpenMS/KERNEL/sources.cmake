@@ -3,6 +3,7 @@ set(directory include/OpenMS/KERNEL)
 
 ### list all header files of the directory here
 set(sources_list_h
+AreaIndex.h
 AreaIterator.h
 BaseFeature.h
 ChromatogramPeak.h
@@ -23,6 +24,7 @@ MSExperiment.h
 MSSpectrum.h
 Peak1D.h
 Peak2D.h
+PeakArrays.h
 PeakIndex.h
 RangeManager.h
 RangeUtils.h
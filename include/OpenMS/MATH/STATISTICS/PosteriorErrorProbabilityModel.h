@@ -164,6 +164,12 @@ public:
         return smallest_score_;
       }
 
+      /// returns the log-likelihood of the initial parameters and after each iteration of the EM algorithm of the last fit
+      const std::vector<DoubleReal> & getLikelihoodTrace() const
+      {
+        return likelihood_trace_;
+      }
+
 private:
       /// assignment operator (not implemented)
       PosteriorErrorProbabilityModel & operator=(const PosteriorErrorProbabilityModel & rhs);
@@ -181,6 +187,8 @@ private:
       DoubleReal max_correctly_;
       ///smallest score which was used for fitting the model
       DoubleReal smallest_score_;
+      ///log-likelihoods of the EM iterations of the last fit
+      std::vector<DoubleReal> likelihood_trace_;
       ///points to getGauss
       DoubleReal (PosteriorErrorProbabilityModel::* calc_incorrect_)(DoubleReal x, const GaussFitter::GaussFitResult & params);
       ///points either to getGumbel or getGauss depending on whether on uses the gumbel or th gaussian distribution for incorrectly assigned sequences.
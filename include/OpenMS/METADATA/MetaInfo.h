@@ -37,6 +37,7 @@
 
 #include <map>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include <OpenMS/CONCEPT/Types.h>
@@ -62,6 +63,11 @@ namespace OpenMS
       MetaInfoInterface, instead of simply adding MetaInfo as member. MetaInfoInterface implements
       a full interface to a MetaInfo member.
 
+      The values are stored in a flat vector of (index, value) pairs which is kept sorted by index.
+      Typical objects carry only a handful of meta values, for which a binary search over contiguous
+      memory is faster and much smaller than a tree of map nodes. Copying a MetaInfo is a single
+      allocation plus the copies of the values. Use getMemoryUsage() to inspect the footprint.
+
       @ingroup Metadata
   */
   class OPENMS_DLLAPI MetaInfo
@@ -119,11 +125,32 @@ public:
     /// removes all meta values
     void clear();
 
+    /// returns the number of meta values
+    Size size() const;
+
+    /**
+      @brief Returns the approximate number of bytes used by this object
+
+      Includes the object itself, the storage of the entry vector (using its capacity) and
+      the heap memory held by string and list values and by units.
+    */
+    Size getMemoryUsage() const;
+
 private:
+    /// Entry type: index and the corresponding value
+    typedef std::pair<UInt, DataValue> Entry_;
+    /// Container type: sorted by index, without duplicates
+    typedef std::vector<Entry_> EntryContainer_;
+
+    /// returns the position of the first entry with an index not less than @p index
+    EntryContainer_::iterator lowerBound_(UInt index);
+    /// returns the position of the first entry with an index not less than @p index
+    EntryContainer_::const_iterator lowerBound_(UInt index) const;
+
     /// static MetaInfoRegistry
     static MetaInfoRegistry registry_;
-    /// the actual mapping of index to the DataValue
-    std::map<UInt, DataValue> index_to_value_;
+    /// the actual mapping of index to the DataValue (sorted by index)
+    EntryContainer_ index_to_value_;
 
   };
 
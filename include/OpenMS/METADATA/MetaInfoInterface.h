@@ -112,6 +112,9 @@ public:
     /// removes all meta values
     void clearMetaInfo();
 
+    /// returns the approximate number of bytes allocated for meta values (0 if none were ever set)
+    Size getMetaInfoMemoryUsage() const;
+
 protected:
     /// creates the MetaInfo object if it does not exist
     inline void createIfNotExists_();
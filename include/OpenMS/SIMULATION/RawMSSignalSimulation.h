@@ -97,6 +97,26 @@ protected:
     /// Default constructor
     RawMSSignalSimulation();
 
+    /**
+     @brief Signal of a single feature, sampled into consecutive scans of an experiment
+
+     The raw signal and the centroided ground truth of scan @p first_scan + i are stored at position i.
+     */
+    struct FeatureSignal_
+    {
+      FeatureSignal_() :
+        first_scan(0)
+      {
+      }
+
+      /// index of the first scan the feature was sampled in
+      Size first_scan;
+      /// raw signal per scan
+      std::vector<std::vector<SimPointType> > raw;
+      /// centroided ground truth per scan
+      std::vector<std::vector<SimPointType> > centroided;
+    };
+
     /// Synchronize members with param class
     void updateMembers_();
 
@@ -121,6 +141,22 @@ protected:
      */
     void add2DSignal_(Feature & feature, MSSimExperiment & experiment, MSSimExperiment & experiment_ct);
 
+    /**
+     @brief Sample the 2D signal of a single feature without adding it to the experiment
+
+     @param feature The feature which should be simulated
+     @param experiment The experiment which defines the scans (not modified)
+     @param signal The sampled signal (see addFeatureSignal_())
+     */
+    void sample2DSignal_(Feature & feature, const MSSimExperiment & experiment, FeatureSignal_ & signal);
+
+    /**
+     @brief Add the part of a sampled feature signal which falls into the scans [@p scan_begin, @p scan_end) to the experiment
+
+     @return The number of raw data points added
+     */
+    Size addFeatureSignal_(const FeatureSignal_ & signal, Size scan_begin, Size scan_end, MSSimExperiment & experiment, MSSimExperiment & experiment_ct) const;
+
     /**
      @brief Samples signals for the given 1D model
 
@@ -146,8 +182,8 @@ protected:
      @param mz_end End coordinate (in m/z dimension) of the region where the signals will be sampled
      @param rt_start Start coordinate (in rt dimension) of the region where the signals will be sampled
      @param rt_end End coordinate (in rt dimension) of the region where the signals will be sampled
-     @param experiment Experiment to which the sampled signals will be added
-     @param experiment_ct Experiment to which the centroided Ground Truth sampled signals will be added
+     @param experiment Experiment which defines the scans the signals are sampled in
+     @param signal The raw signals and the centroided Ground Truth sampled signals
      @param activeFeature The current feature that is simulated
      */
     void samplePeptideModel2D_(const ProductModel<2> & pm,
@@ -155,8 +191,8 @@ protected:
                                const SimCoordinateType mz_end,
                                SimCoordinateType rt_start,
                                SimCoordinateType rt_end,
-                               MSSimExperiment & experiment,
-                               MSSimExperiment & experiment_ct,
+                               const MSSimExperiment & experiment,
+                               FeatureSignal_ & signal,
                                Feature & activeFeature);
 
     /**
@@ -187,6 +223,9 @@ protected:
     /// Compress signals in a single RT scan (to merge signals which were sampled overlapping)
     void compressSignals_(MSSimExperiment & experiment);
 
+    /// Compress the signals of a single scan onto @p grid; returns false if the scan does not need compression
+    bool compressSpectrum_(MSSimExperiment::SpectrumType & spectrum, const std::vector<SimCoordinateType> & grid) const;
+
     /// number of points sampled per peak's FWHM
     Int sampling_points_per_FWHM_;
 
@@ -0,0 +1,147 @@
+// --------------------------------------------------------------------------
+//                   OpenMS -- Open-Source Mass Spectrometry
+// --------------------------------------------------------------------------
+// Copyright The OpenMS Team -- Eberhard Karls University Tuebingen,
+// ETH Zurich, and Freie Universitaet Berlin 2002-2013.
+//
+// This software is released under a three-clause BSD license:
+//  * Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//  * Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+//  * Neither the name of any author or any participating institution
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+// For a full list of authors, refer to the file AUTHORS.
+// --------------------------------------------------------------------------
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL ANY OF THE AUTHORS OR THE CONTRIBUTING
+// INSTITUTIONS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+// ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// --------------------------------------------------------------------------
+// $Maintainer: Timo Sachsenberg $
+// $Authors: $
+// --------------------------------------------------------------------------
+
+#ifndef OPENMS_VISUAL_INTENSITYPYRAMID_H
+#define OPENMS_VISUAL_INTENSITYPYRAMID_H
+
+#include <OpenMS/KERNEL/MSExperiment.h>
+
+#include <vector>
+
+namespace OpenMS
+{
+  /**
+    @brief Multi-resolution raster of maximum intensities of a peak map
+
+    The base level divides the RT/m/z area of the MS1 spectra into a grid
+    and stores the maximum intensity of the peaks in each cell. Each further
+    level merges 2x2 cells of the level below, until a single cell is left.
+
+    Spectrum2DCanvas uses it to paint large maps: it chooses the coarsest
+    level whose cells are still smaller than a pixel, so repainting costs are
+    bound by the number of pixels instead of the number of peaks. When the
+    cells of the base level are larger than a pixel, the peaks are painted
+    directly.
+
+    The pyramid does not depend on Qt. The base level is rasterized directly
+    from the map in a single pass over the peaks (buildBaseLevel()). The
+    coarser levels only depend on the base level, so buildLevels() can run in
+    a worker thread while the map is changed by the GUI.
+
+    @ingroup Visual
+  */
+  class OPENMS_GUI_DLLAPI IntensityPyramid
+  {
+public:
+    /// Default constructor (empty pyramid)
+    IntensityPyramid();
+
+    /// Builds the pyramid from the MS1 spectra of @p map (see buildBaseLevel() and buildLevels())
+    void build(const MSExperiment<> & map, Size max_rt_bins = 2048, Size max_mz_bins = 2048);
+
+    /**
+      @brief Rasterizes the MS1 spectra of @p map into the base level and removes all other levels
+
+      The base level has at most @p max_rt_bins cells in RT (but not more than
+      there are MS1 spectra) and @p max_mz_bins cells in m/z.
+
+      @note The spectra of @p map have to be sorted by RT and m/z.
+    */
+    void buildBaseLevel(const MSExperiment<> & map, Size max_rt_bins = 2048, Size max_mz_bins = 2048);
+
+    /// Builds the coarser levels from the base level (does not access the map)
+    void buildLevels();
+
+    /// Removes all levels
+    void clear();
+
+    /// Returns if the pyramid contains no data
+    bool empty() const;
+
+    /// Returns the number of levels (0 if empty)
+    Size getLevelCount() const;
+
+    /// Returns the number of RT cells of @p level
+    Size getRTBinCount(Size level) const;
+
+    /// Returns the number of m/z cells of @p level
+    Size getMZBinCount(Size level) const;
+
+    /// Returns the maximum intensity of a cell (-1 if it contains no peak)
+    Real getIntensity(Size level, Size rt_bin, Size mz_bin) const;
+
+    /**
+      @brief Returns the coarsest level whose cells are not larger than the given size
+
+      @param rt_size Size of a pixel in RT
+      @param mz_size Size of a pixel in m/z
+
+      @return The level or -1 if even the cells of the base level are too large
+    */
+    Int findLevel(DoubleReal rt_size, DoubleReal mz_size) const;
+
+    /**
+      @brief Returns the maximum intensity of all cells of @p level that overlap the given area
+
+      @return The maximum intensity or -1 if there is no peak
+    */
+    Real getMaximum(Size level, DoubleReal rt_min, DoubleReal rt_max, DoubleReal mz_min, DoubleReal mz_max) const;
+
+protected:
+    /// One level of the pyramid (row-major, RT cells are rows)
+    struct Level_
+    {
+      Size rt_bins;
+      Size mz_bins;
+      std::vector<Real> intensities;
+    };
+
+    /// Returns the range of base level cells that overlap [@p min, @p max], false if there is none
+    bool baseBins_(DoubleReal min, DoubleReal max, DoubleReal origin, DoubleReal width, Size bins, Size & first, Size & last) const;
+
+    /// The levels, starting with the finest one
+    std::vector<Level_> levels_;
+    /// Minimal RT of the base level
+    DoubleReal rt_min_;
+    /// Minimal m/z of the base level
+    DoubleReal mz_min_;
+    /// RT width of the base level cells
+    DoubleReal rt_width_;
+    /// m/z width of the base level cells
+    DoubleReal mz_width_;
+  };
+
+} // namespace OpenMS
+
+#endif // OPENMS_VISUAL_INTENSITYPYRAMID_H
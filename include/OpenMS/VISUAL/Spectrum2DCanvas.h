@@ -40,8 +40,10 @@
 #include <OpenMS/VISUAL/SpectrumCanvas.h>
 #include <OpenMS/VISUAL/Spectrum1DCanvas.h>
 #include <OpenMS/KERNEL/PeakIndex.h>
+#include <OpenMS/VISUAL/IntensityPyramid.h>
 
 // QT
+#include <QtCore/QFuture>
 class QPainter;
 class QMouseEvent;
 
@@ -116,6 +118,8 @@ public slots:
     void removeLayer(Size layer_index);
     //docu in base class
     virtual void updateLayer(Size i);
+    //docu in base class
+    virtual void prepareLayerUpdate(Size i);
     // Docu in base class
     virtual void horizontalScrollBarChange(int value);
     // Docu in base class
@@ -137,6 +141,9 @@ protected slots:
     /// Reacts on changed layer parameters
     void currentLayerParametersChanged_();
 
+    /// Repaints when the pyramid of a layer has been built
+    void pyramidFinished_();
+
 protected:
     // Docu in base class
     bool finishAdding_();
@@ -179,6 +186,10 @@ protected:
       Paints the peaks as small ellipses. The peaks are colored according to the
       selected dot gradient.
 
+      If the pyramid of the layer is ready and its cells are smaller than a
+      pixel, the maxima are taken from the pyramid instead of the peaks.
+      This is not done if data filters are active.
+
       @param layer_index The index of the layer.
       @param rt_pixel_count
       @param mz_pixel_count
@@ -365,6 +376,35 @@ protected:
 
     /// Finishes context menu after customization to peaks, features or consensus features
     void finishContextMenu_(QMenu* context_menu, QMenu* settings_menu);
+
+    /// Level-of-detail pyramid of the peak data of a layer
+    struct LayerPyramid_
+    {
+      /// The peak data the pyramid belongs to (only used to find the layer, the worker does not access it)
+      ExperimentSharedPtrType map;
+      /// Number of spectra and peaks of the peak data when the base level was rasterized
+      Size spectrum_count;
+      UInt64 peak_count;
+      /// The pyramid (base level filled by the GUI thread, coarser levels by a worker thread)
+      boost::shared_ptr<IntensityPyramid> pyramid;
+      /// Result of the worker thread
+      QFuture<void> future;
+    };
+
+    /// Starts building the pyramid of layer @p layer_index in a worker thread (large peak layers only)
+    void buildPyramid_(Size layer_index);
+
+    /// Returns the pyramid of layer @p layer_index if it is ready, 0 otherwise
+    const IntensityPyramid* getPyramid_(Size layer_index) const;
+
+    /// Removes the pyramids of peak data that is not shown any more
+    void removeUnusedPyramids_();
+
+    /// Builds the coarser levels of @p pyramid from its base level (executed by a worker thread)
+    static void computePyramid_(boost::shared_ptr<IntensityPyramid> pyramid);
+
+    /// Pyramids of the peak layers
+    std::vector<LayerPyramid_> pyramids_;
   };
 }
 
@@ -598,6 +598,13 @@ public slots:
     ///Updates layer @p i when the data in the corresponding file changes
     virtual void updateLayer(Size i) = 0;
 
+    /**
+      @brief Has to be called before the data of layer @p i is changed in place (e.g. reloaded from its file)
+
+      Call updateLayer() after the change. The default implementation does nothing.
+    */
+    virtual void prepareLayerUpdate(Size i);
+
 signals:
 
     /// Signal emitted whenever the modification status of a layer changes (editing and storing)
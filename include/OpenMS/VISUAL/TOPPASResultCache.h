@@ -0,0 +1,131 @@
+// --------------------------------------------------------------------------
+//                   OpenMS -- Open-Source Mass Spectrometry
+// --------------------------------------------------------------------------
+// Copyright The OpenMS Team -- Eberhard Karls University Tuebingen,
+// ETH Zurich, and Freie Universitaet Berlin 2002-2013.
+//
+// This software is released under a three-clause BSD license:
+//  * Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//  * Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+//  * Neither the name of any author or any participating institution
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+// For a full list of authors, refer to the file AUTHORS.
+// --------------------------------------------------------------------------
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL ANY OF THE AUTHORS OR THE CONTRIBUTING
+// INSTITUTIONS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+// ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// --------------------------------------------------------------------------
+// $Maintainer: Johannes Junker $
+// $Authors: $
+// --------------------------------------------------------------------------
+
+#ifndef OPENMS_VISUAL_TOPPASRESULTCACHE_H
+#define OPENMS_VISUAL_TOPPASRESULTCACHE_H
+
+#include <OpenMS/config.h>
+#include <OpenMS/DATASTRUCTURES/String.h>
+
+#include <QtCore/QString>
+#include <QtCore/QStringList>
+#include <QtCore/QDateTime>
+
+#include <map>
+
+namespace OpenMS
+{
+  class Param;
+
+  /**
+      @brief A content-addressed cache for the output files of TOPP tool runs
+
+      Each run of a TOPP tool is identified by a key computed from everything
+      that determines its result, i.e. the tool name, type and version, its
+      parameters and the content of its input files (see computeKey()). After
+      a successful run, the output files are stored under this key in the cache
+      directory. If a later run has the same key, the outputs can be restored
+      from the cache instead of running the tool again.
+
+      An entry is only valid once all of its files are stored completely, so
+      interrupted runs never produce a cache hit.
+
+      @ingroup TOPPAS_elements
+  */
+  class OPENMS_GUI_DLLAPI TOPPASResultCache
+  {
+public:
+
+    /// Default constructor (caching disabled)
+    TOPPASResultCache();
+    /// Constructor with cache directory (an empty name disables caching)
+    explicit TOPPASResultCache(const QString & directory);
+    /// Destructor
+    virtual ~TOPPASResultCache();
+
+    /// Sets the cache directory (an empty name disables caching)
+    void setDirectory(const QString & directory);
+    /// Returns the cache directory
+    const QString & getDirectory() const;
+    /// Returns if a cache directory is set
+    bool isEnabled() const;
+
+    /**
+      @brief Returns the SHA-1 hash of the content of @p file (empty if it cannot be read)
+
+      Hashes are remembered as long as size and modification time of the file do not change,
+      so files consumed by several tools are read only once.
+    */
+    String hashFile(const QString & file) const;
+    /// Returns the SHA-1 hash of all names and values of @p param
+    static String hashParam(const Param & param);
+    /// Combines the (ordered) @p parts describing a tool run to a cache key
+    static String computeKey(const QStringList & parts);
+
+    /// Returns if a complete entry with @p file_count files exists for @p key
+    bool contains(const String & key, Size file_count) const;
+    /**
+      @brief Copies the cached files of @p key to @p output_files (in the order they were stored)
+
+      @return false if there is no matching entry or a file could not be copied
+    */
+    bool restore(const String & key, const QStringList & output_files) const;
+    /**
+      @brief Stores @p output_files under @p key, replacing an existing entry
+
+      @return false if caching is disabled or a file could not be copied
+    */
+    bool store(const String & key, const QStringList & output_files) const;
+
+protected:
+
+    /// Size, modification time and hash of a file
+    struct FileHash_
+    {
+      qint64 size;
+      QDateTime modified;
+      String hash;
+    };
+
+    /// Returns the directory of entry @p key
+    QString entryPath_(const String & key) const;
+
+    /// The cache directory
+    QString directory_;
+    /// Hashes of files already read
+    mutable std::map<QString, FileHash_> file_hashes_;
+  };
+}
+
+#endif
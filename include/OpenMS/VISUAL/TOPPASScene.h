@@ -39,9 +39,11 @@
 #include <OpenMS/VISUAL/TOPPASEdge.h>
 #include <OpenMS/DATASTRUCTURES/String.h>
 #include <OpenMS/VISUAL/TOPPASToolVertex.h>
+#include <OpenMS/VISUAL/TOPPASResultCache.h>
 
 #include <QtGui/QGraphicsScene>
 #include <QtCore/QProcess>
+#include <QtCore/QElapsedTimer>
 
 namespace OpenMS
 {
@@ -96,7 +98,11 @@ public:
         proc(p),
         command(cmd),
         args(arg),
-        tv(tool)
+        tv(tool),
+        threads(1),
+        memory(0),
+        priority(0),
+        timer()
       {
       }
 
@@ -108,6 +114,14 @@ public:
       QStringList args;
       /// The tool which is started (used to call its slots)
       TOPPASToolVertex * tv;
+      /// Number of threads the process uses (set by enqueueProcess())
+      int threads;
+      /// Memory the process uses in MB, 0 if unknown (set by enqueueProcess())
+      UInt memory;
+      /// Number of tools on the longest path starting at the tool, pending processes with a higher priority are started first (set by enqueueProcess())
+      Size priority;
+      /// Measures the wall time of the process
+      QElapsedTimer timer;
     };
 
     /// The current action mode (creation of a new edge, or panning of the widget)
@@ -203,9 +217,21 @@ public:
     bool isPipelineRunning();
     /// Shows a dialog that allows to specify the output directory. If @p always_ask == false, the dialog won't be shown if a directory has been set, already.
     bool askForOutputDir(bool always_ask = true);
-    /// Enqueues the process, it will be run when the currently pending processes have finished
+    /**
+      @brief Enqueues the process, it will be run when enough threads and memory are available
+
+      The resource usage of the process is taken from its tool (see TOPPASToolVertex::getThreadCount() and
+      TOPPASToolVertex::getMemoryCost()). Its priority is the number of tools on the longest path starting at
+      the tool (critical path), so tools that many others depend upon are started first.
+    */
     void enqueueProcess(const TOPPProcess & process);
-    /// Runs the next process in the queue, if any
+    /**
+      @brief Starts pending processes as long as there are free resources
+
+      Of all pending processes that fit into the free threads and memory, the one with the highest priority
+      is started. A process which needs more than the allowed resources is started when no other process
+      is running.
+    */
     void runNextProcess();
     /// Resets the processes queue
     void resetProcessesQueue();
@@ -235,8 +261,14 @@ public:
     QString getDescription() const;
     /// when description is updated by user, use this to update the description for later storage in file
     void setDescription(const QString & desc);
-    /// sets the maximum number of jobs
+    /// sets the maximum number of threads used by all running processes (each process counts with its number of threads)
     void setAllowedThreads(int num_threads);
+    /// sets the maximum memory (in MB) used by all running processes (0 = no limit)
+    void setAllowedMemory(UInt memory);
+    /// sets the directory of the result cache, where tool results are kept for later runs with identical inputs and parameters ("" disables caching)
+    void setResultCacheDirectory(const QString & dir);
+    /// returns the result cache
+    TOPPASResultCache & getResultCache();
     /// returns the hovering edge
     TOPPASEdge* getHoveringEdge();
     /// Checks whether all output vertices are finished, and if yes, emits entirePipelineFinished() (called by finished output vertices)
@@ -268,8 +300,8 @@ public slots:
     void setPipelineRunning(bool b = true);
     /// Invoked by TTV or other vertices if a parameter was edited
     void changedParameter(const bool invalidates_running_pipeline);
-    /// Called by a finished QProcess to indicate that we are free to start a new one
-    void processFinished();
+    /// Called by a finished QProcess to release its resources and log its run time, starts pending processes
+    void processFinished(QProcess * process);
     /// dirty solution: when using ExecutePipeline this slot is called when the pipeline crashes. This will quit the app
     void quitWithError();
 
@@ -344,16 +376,24 @@ protected:
     bool user_specified_out_dir_;
     /// The queue of pending TOPP processes
     QList<TOPPProcess> topp_processes_queue_;
+    /// The running TOPP processes
+    QList<TOPPProcess> topp_processes_running_;
     /// Stores the clipboard content when requested from TOPPASBase
     TOPPASScene * clipboard_;
     /// dry run mode (no tools are actually called)
     bool dry_run_;
-    /// currently running processes...
+    /// number of threads used by the running processes
     int threads_active_;
+    /// memory (in MB) used by the running processes
+    UInt memory_active_;
     /// description text
     QString description_text_;
     /// maximum number of allowed threads
     int allowed_threads_;
+    /// maximum memory (in MB) of all running processes, 0 if not limited
+    UInt allowed_memory_;
+    /// results of earlier tool runs
+    TOPPASResultCache result_cache_;
     /// last node where 'resume' was started
     TOPPASToolVertex* resume_source_;
 
@@ -363,6 +403,10 @@ protected:
     bool isEdgeAllowed_(TOPPASVertex * u, TOPPASVertex * v);
     /// DFS helper method. Returns true, if a back edge has been discovered
     bool dfsVisit_(TOPPASVertex * vertex);
+    /// Returns the number of tool vertices on the longest path starting at @p vertex (memoized in @p lengths)
+    Size criticalPathLength_(TOPPASVertex * vertex, std::map<TOPPASVertex *, Size> & lengths) const;
+    /// Returns whether @p process fits into the currently free threads and memory
+    bool fitsResources_(const TOPPProcess & process) const;
     /// Performs a sanity check of the pipeline and notifies user when it finds something strange. Returns if pipeline OK.
     /// if 'allowUserOverride' is true, some dialogs are shown which allow the user to ignore some warnings (e.g. disconnected nodes)
     bool sanityCheck_(bool allowUserOverride);
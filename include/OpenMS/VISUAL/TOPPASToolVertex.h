@@ -39,6 +39,9 @@
 #include <OpenMS/DATASTRUCTURES/Param.h>
 
 #include <QtCore/QVector>
+#include <QtCore/QMap>
+#include <QtCore/QPair>
+#include <QtCore/QStringList>
 
 namespace OpenMS
 {
@@ -151,6 +154,16 @@ public:
     void setParam(const Param & param);
     /// Returns the Param object of this tool
     const Param & getParam();
+    /// Sets the number of threads reserved for a run of this tool (0 = take the value of the tool's '-threads' parameter)
+    void setCPUCost(Int threads);
+    /// Returns the number of threads set by setCPUCost() (0 = take the value of the tool's '-threads' parameter)
+    Int getCPUCost() const;
+    /// Returns the number of threads a run of this tool is expected to occupy (at least 1)
+    Int getThreadCount() const;
+    /// Sets the memory (in MB) reserved for a run of this tool (0 = unknown)
+    void setMemoryCost(UInt memory);
+    /// Returns the memory (in MB) reserved for a run of this tool (0 = unknown)
+    UInt getMemoryCost() const;
     /// Checks if all parent nodes have finished the tool execution and, if so, runs the tool
     void run();
     /// Updates the vector containing the lists of current output files for all output parameters
@@ -233,6 +246,16 @@ protected:
     bool initParam_(const QString & old_ini_file = "");
     /// Fills @p io_infos with the required input/output file/list parameters. If @p input_params is true, input params are returned, otherwise output params.
     void getParameters_(QVector<IOInfo> & io_infos, bool input_params) const;
+    /// Returns the output files of round @p round, ordered by output parameter
+    QStringList getRoundOutputFiles_(int round) const;
+    /**
+      @brief Computes the result cache key of round @p round
+
+      The key covers tool name, type and version, the parameters, and the content of the input files
+      (from incoming edges in @p pkg and from unconnected input file parameters). Returns an empty
+      key if an input file cannot be read.
+    */
+    String computeCacheKey_(const RoundPackages & pkg, int round, const QVector<IOInfo> & in_params, const QVector<IOInfo> & out_params) const;
     /// Writes @p param to the @p ini_file
     void writeParam_(const Param & param, const QString & ini_file);
     /// Helper method for finding good boundaries for wrapping the tool name. Returns a string with whitespaces at the preferred boundaries.
@@ -246,10 +269,18 @@ protected:
     String tmp_path_;
     /// The parameters of the tool
     Param param_;
+    /// The version of the tool (as reported in its INI file)
+    String tool_version_;
     /// current status of the tool
     TOOLSTATUS status_;
     /// tool initialization status: if C'tor was successful in finding the TOPP tool, this is set to 'true'
     bool tool_ready_;
+    /// threads reserved for a run of the tool (0 = use '-threads')
+    Int cpu_cost_;
+    /// memory (in MB) reserved for a run of the tool (0 = unknown)
+    UInt memory_cost_;
+    /// Result cache keys (and rounds) of the running processes whose outputs are to be cached
+    QMap<QObject *, QPair<int, String> > cache_keys_;
 
     /// UID for output files
     static UInt uid_;
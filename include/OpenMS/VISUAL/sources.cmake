@@ -64,6 +64,7 @@ AxisWidget.h
 ColorSelector.h
 EnhancedTabBar.h
 HistogramWidget.h
+IntensityPyramid.h
 LayerData.h
 MetaDataBrowser.h
 MultiGradient.h
@@ -93,6 +94,7 @@ TOPPASTabBar.h
 TOPPASTreeView.h
 TOPPASResource.h
 TOPPASResources.h
+TOPPASResultCache.h
 TOPPViewBehaviorInterface.h
 TOPPViewIdentificationViewBehavior.h
 TOPPViewSpectraViewBehavior.h
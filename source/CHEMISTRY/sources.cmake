@@ -10,7 +10,9 @@ Element.C
 ElementDB.C
 EmpiricalFormula.C
 EnzymaticDigestion.C
+EnzymaticDigestionCursor.C
 IsotopeDistribution.C
+IsotopePatternCache.C
 ModificationDefinition.C
 ModificationDefinitionsSet.C
 ModificationsDB.C
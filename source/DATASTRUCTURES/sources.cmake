@@ -30,6 +30,7 @@ Map.C
 MassExplainer.C
 Matrix.C
 Param.C
+PeptideMassIndex.C
 QTCluster.C
 SparseVector.C
 String.C
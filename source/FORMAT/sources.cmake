@@ -23,6 +23,7 @@ FileTypes.C
 GzipIfstream.C
 GzipInputStream.C
 IdXMLFile.C
+IndexedFASTAFile.C
 IndexedMzMLFile.C
 IndexedMzMLFileLoader.C
 InspectInfile.C
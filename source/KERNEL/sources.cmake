@@ -20,6 +20,7 @@ MSSpectrum.C
 OnDiscMSExperiment.C
 Peak1D.C
 Peak2D.C
+PeakArrays.C
 PeakIndex.C
 RangeManager.C
 RichPeak1D.C
@@ -43,6 +43,7 @@ set(datastructures_executables_list
 	MassExplainer_test
 	Matrix_test
   Param_test
+	PeptideMassIndex_test
 	QTCluster_test
 	RangeManager_test
 	SparseVector_test
@@ -101,6 +102,7 @@ set(system_executables_list
 )
 
 set(kernel_executables_list
+	AreaIndex_test
 	AreaIterator_test
 	BaseFeature_test
 	ChromatogramPeak_test
@@ -122,6 +124,7 @@ set(kernel_executables_list
 	MSSpectrum_test
 	Peak1D_test
 	Peak2D_test
+	PeakArrays_test
 	PeakIndex_test
 	RangeUtils_test
 	RichPeak1D_test
@@ -131,7 +134,9 @@ set(kernel_executables_list
 
 set(visual_executables_list
   AxisTickCalculator_test
+  IntensityPyramid_test
   MultiGradient_test
+  TOPPASResultCache_test
 )
 
 set(format_executables_list
@@ -149,6 +154,7 @@ set(format_executables_list
   DTAFile_test
   EDTAFile_test
   FASTAFile_test
+  IndexedFASTAFile_test
   FeatureXMLFile_test
   FileHandler_test
   FileTypes_test
@@ -272,6 +278,8 @@ MassTraceDetection_test
   SignalToNoiseEstimatorMeanIterative_test
   SignalToNoiseEstimatorMedian_test
   SignalToNoiseEstimator_test
+  SpectraFilterConsumer_test
+  SpectraFilterDriver_test
   SqrtMower_test
   TICFilter_test
   TOFCalibration_test
@@ -316,9 +324,11 @@ set(chemistry_executables_list
   Element_test
   EmpiricalFormula_test
   EnzymaticDigestion_test
+  EnzymaticDigestionCursor_test
   FastaIteratorIntern_test
   FastaIterator_test
   IsotopeDistribution_test
+  IsotopePatternCache_test
   ModificationDefinition_test
   ModificationDefinitionsSet_test
   ModificationsDB_test
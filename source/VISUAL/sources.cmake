@@ -9,6 +9,7 @@ AxisWidget.C
 ColorSelector.C
 EnhancedTabBar.C
 HistogramWidget.C
+IntensityPyramid.C
 LayerData.C
 MetaDataBrowser.C
 MultiGradient.C
@@ -39,6 +40,7 @@ TOPPASTabBar.C
 TOPPASTreeView.C
 TOPPASResource.C
 TOPPASResources.C
+TOPPASResultCache.C
 TOPPViewBehaviorInterface.C
 TOPPViewIdentificationViewBehavior.C
 TOPPViewSpectraViewBehavior.C